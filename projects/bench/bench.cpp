@@ -0,0 +1,124 @@
+/*
+ *******************************************************************************
+ *
+ *
+ * Module name     :   bench.cpp
+ * Module ID Nbr   :
+ * Description     :   Measure the time and the number of heap allocations of one
+ *                     float_precision +=, -=, *=, /= and sqrt() at different precisions
+ * --------------------------------------------------------------------------
+ * Change Record   :
+ *
+ * Version	Author/Date		Description of changes
+ * -------  ---------------	----------------------
+ * 01.01	agent/16-OCT-2026	Initial release
+ *
+ * End of Change Record
+ * --------------------------------------------------------------------------
+*/
+
+// Usage: bench [precision ...]
+// For each precision a table with the time in microseconds and the number of calls to operator new
+// per operation is written to stdout. The default precisions are 20 100 1000 10000
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <new>
+#include <string>
+
+#include "precision/iprecision.h"
+#include "precision/fprecision.h"
+
+static unsigned long allocations = 0;	// Number of calls to operator new since the start of the program
+
+// Count every allocation of the program
+void *operator new( size_t n )
+	{
+	void *p;
+
+	++allocations;
+	if( ( p = malloc( n ? n : 1 ) ) == NULL )
+		throw std::bad_alloc();
+	return p;
+	}
+
+void operator delete( void *p ) noexcept
+	{
+	free( p );
+	}
+
+void operator delete( void *p, size_t ) noexcept
+	{
+	free( p );
+	}
+
+enum operation { ADD, SUB, MUL, DIV, SQRT };
+
+// Do one operation. The result is assigned to r that already has the precision so only the operation itself allocate
+static void run( enum operation op, float_precision& r, const float_precision& x, const float_precision& y )
+	{
+	r = x;
+	switch( op )
+		{
+		case ADD: r += y; break;
+		case SUB: r -= y; break;
+		case MUL: r *= y; break;
+		case DIV: r /= y; break;
+		case SQRT: r = sqrt( x ); break;
+		}
+	}
+
+// Return the fastest time in seconds of one operation and the number of allocations of it. Each sample is repeated until it takes at least 20ms
+static double measure( enum operation op, float_precision& r, const float_precision& x, const float_precision& y, unsigned long *count )
+	{
+	double best = 1e30;
+
+	run( op, r, x, y );		// Let r get a buffer of the right size
+	*count = allocations;
+	run( op, r, x, y );
+	*count = allocations - *count;
+	for( int sample = 0; sample < 3; ++sample )
+		{
+		int reps = 0;
+		clock_t start = clock(), stop;
+
+		do
+			{
+			run( op, r, x, y );
+			++reps;
+			stop = clock();
+			} while( stop - start < CLOCKS_PER_SEC / 50 );
+		double t = (double)( stop - start ) / CLOCKS_PER_SEC / reps;
+		if( t < best )
+			best = t;
+		}
+	return best;
+	}
+
+int main( int argc, char *argv[] )
+	{
+	static const unsigned int defaults[] = { 20, 100, 1000, 10000 };
+	static const char *names[] = { "+=", "-=", "*=", "/=", "sqrt" };
+	int i, count = argc > 1 ? argc - 1 : (int)( sizeof( defaults ) / sizeof( defaults[0] ) );
+
+	printf( "%10s %6s %12s %12s\n", "precision", "op", "us/op", "allocs/op" );
+	for( i = 0; i < count; ++i )
+		{
+		unsigned int precision = argc > 1 ? (unsigned int)atoi( argv[i+1] ) : defaults[i];
+		float_precision x( 2, precision ), y( 3, precision ), r( 0, precision );
+
+		// Operands with all digits in use and different exponents
+		x = sqrt( x );
+		y = float_precision( 1, precision ) / y;
+		for( int op = ADD; op <= SQRT; ++op )
+			{
+			unsigned long allocs;
+			double t = measure( (enum operation)op, r, x, y, &allocs );
+
+			printf( "%10u %6s %12.3f %12lu\n", precision, names[op], t * 1e6, allocs );
+			}
+		}
+
+	return 0;
+	}
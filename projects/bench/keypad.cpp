@@ -0,0 +1,141 @@
+/*
+ *******************************************************************************
+ *
+ *
+ * Module name     :   keypad.cpp
+ * Module ID Nbr   :
+ * Description     :   Count the heap allocations of keypad sequences replayed through calc::Calculator
+ * --------------------------------------------------------------------------
+ * Change Record   :
+ *
+ * Version	Author/Date		Description of changes
+ * -------  ---------------	----------------------
+ * 01.01	agent/16-OCT-2026	Initial release
+ *
+ * End of Change Record
+ * --------------------------------------------------------------------------
+*/
+
+// Usage: keypad [repeats [sequence ...]]
+// Each sequence is replayed repeats times (default 2000) and the number of calls to operator new, the bytes
+// allocated and the time is written to stdout. The keys are the digits, '.', '+', '-', '*', '/', '=',
+// 'M' for M+ and 'C' for AC. Each sequence is followed by AC so the replays start from the same state
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <new>
+#include <string>
+
+#include "calculator.h"
+
+static unsigned long allocations = 0;	// Number of calls to operator new since the start of the program
+static unsigned long allocated = 0;		// Number of bytes requested from operator new since the start of the program
+
+// Count every allocation of the program
+void *operator new( size_t n )
+	{
+	void *p;
+
+	++allocations;
+	allocated += n;
+	if( ( p = malloc( n ? n : 1 ) ) == NULL )
+		throw std::bad_alloc();
+	return p;
+	}
+
+void operator delete( void *p ) noexcept
+	{
+	free( p );
+	}
+
+void operator delete( void *p, size_t ) noexcept
+	{
+	free( p );
+	}
+
+using value_t = calc::Calculator::value_t;
+
+// The digit entry of DigitInputManager in views/calculator_layout.h that can not be included without SDL
+class keypad
+	{
+	bool restart, point;
+	int after;
+
+	public:
+		keypad() : restart( false ), point( false ), after( 0 ) {}
+
+		void digit( int d, calc::Calculator& c )
+			{
+			if( restart )
+				{
+				c.pushValue();
+				c.set( 0 );
+				}
+			if( !point )
+				{
+				c.value().exponent( c.value().exponent() + 1 );
+				c.value() += d;
+				}
+			else
+				{
+				float_precision f = d;
+				f.exponent( -after - 1 );
+				c.value() += f;
+				++after;
+				}
+			restart = false;
+			}
+
+		void reset() { point = false; after = 0; restart = true; }
+
+		// Press one key the way the button lambdas of the calculator layouts do
+		void press( char k, calc::Calculator& c )
+			{
+			switch( k )
+				{
+				case '.': point = true; break;
+				case '+': c.pushOperator( []( value_t v1, value_t v2 ) { return std::move( v1 ) + v2; } ); reset(); break;
+				case '-': c.pushOperator( []( value_t v1, value_t v2 ) { return std::move( v1 ) - v2; } ); reset(); break;
+				case '*': c.pushOperator( []( value_t v1, value_t v2 ) { return std::move( v1 ) * v2; } ); reset(); break;
+				case '/': c.pushOperator( []( value_t v1, value_t v2 ) { return std::move( v1 ) / v2; } ); reset(); break;
+				case '=': c.applyFromStack(); reset(); break;
+				case 'M': c.setMemory( c.memory() + c.value() ); break;
+				case 'C': c.set( 0 ); c.clearStacks(); c.clearMemory(); point = false; after = 0; break;
+				default:
+					if( k >= '0' && k <= '9' )
+						digit( k - '0', c );
+					break;
+				}
+			}
+	};
+
+int main( int argc, char *argv[] )
+	{
+	static const char *defaults[] = { "1234.5+678*9/7-3.25=*2=M12/3=M", "3.14159*2.71828=M/7=+1=", "99999999*99999999=*99999999=" };
+	int repeats = argc > 1 ? atoi( argv[1] ) : 2000;
+	int i, count = argc > 2 ? argc - 2 : (int)( sizeof( defaults ) / sizeof( defaults[0] ) );
+
+	printf( "%-36s %12s %14s %10s\n", "sequence", "allocs/seq", "bytes/seq", "us/seq" );
+	for( i = 0; i < count; ++i )
+		{
+		const std::string seq = std::string( argc > 2 ? argv[i+2] : defaults[i] ) + "C";
+		calc::Calculator c;
+		keypad k;
+		unsigned long a0, b0;
+		clock_t start;
+
+		for( char key : seq )	// Let the stacks get their storage
+			k.press( key, c );
+		a0 = allocations;
+		b0 = allocated;
+		start = clock();
+		for( int r = 0; r < repeats; ++r )
+			for( char key : seq )
+				k.press( key, c );
+		printf( "%-36s %12.1f %14.1f %10.3f\n", seq.c_str(), (double)( allocations - a0 ) / repeats, (double)( allocated - b0 ) / repeats,
+			(double)( clock() - start ) / CLOCKS_PER_SEC / repeats * 1e6 );
+		}
+
+	return 0;
+	}
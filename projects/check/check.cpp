@@ -0,0 +1,186 @@
+/*
+ *******************************************************************************
+ *
+ *
+ * Module name     :   check.cpp
+ * Module ID Nbr   :
+ * Description     :   Regression checks of the float_precision functions
+ * --------------------------------------------------------------------------
+ * Change Record   :
+ *
+ * Version	Author/Date		Description of changes
+ * -------  ---------------	----------------------
+ * 01.01	agent/16-OCT-2026	Initial release. exp() of negative arguments and floor()/ceil()
+ * 01.02	agent/16-OCT-2026	fma(), sum() and dot() of operands with different precisions and exponents
+ * 01.03	agent/16-OCT-2026	_float_table_load() of a valid and of corrupt files
+ * 01.04	agent/16-OCT-2026	int_precision::leading_digits()
+ * 01.05	agent/16-OCT-2026	fraction_precision::reduce()
+ * 01.06	agent/16-OCT-2026	float_precision::leading_digits()
+ *
+ * End of Change Record
+ * --------------------------------------------------------------------------
+*/
+
+// Usage: check
+// Every failed check is written to stdout. The exit code is 1 if any check failed otherwise 0
+
+#include <stdio.h>
+#include <string>
+
+#include "precision/iprecision.h"
+#include "precision/fprecision.h"
+#include "precision/fractionprecision.h"
+
+static int checks = 0, failures = 0;
+
+// Count the check and report it if it failed
+static void check( bool ok, const char *what )
+	{
+	++checks;
+	if( !ok )
+		{
+		++failures;
+		printf( "FAILED: %s\n", what );
+		}
+	}
+
+// Return true if x and y agree to at least digits significant digits
+static bool agree( const float_precision& x, const float_precision& y, unsigned int digits )
+	{
+	float_precision d( 0, digits + 10 ), eps( 1, digits + 10 );
+
+	if( x == y )
+		return true;
+	d = x - y;
+	d = abs( d );
+	eps.exponent( -(int)digits );
+	return d <= eps * abs( y );
+	}
+
+// exp() of a negative argument. Above the series threshold exp() scales the argument with a negative integer
+static void check_exp()
+	{
+	static const unsigned int precisions[] = { 20, 100, 500, 1000 };
+
+	for( unsigned int i = 0; i < sizeof( precisions ) / sizeof( precisions[0] ); ++i )
+		{
+		unsigned int p = precisions[i];
+		float_precision x( "-1.5", p ), one( 1, p ), r( 0, p );
+		char what[64];
+
+		r = exp( x ) * exp( -x );
+		sprintf( what, "exp(-1.5)*exp(1.5)==1 at %u digits", p );
+		check( agree( r, one, p - 2 ), what );
+		r = exp( x );
+		sprintf( what, "exp(-1.5)==1/exp(1.5) at %u digits", p );
+		check( agree( r, one / exp( -x ), p - 2 ), what );
+		x = float_precision( "-1000.25", p );
+		r = log( exp( x ) );
+		sprintf( what, "log(exp(-1000.25))==-1000.25 at %u digits", p );
+		check( agree( r, x, p - 6 ), what );
+		}
+	}
+
+// floor() and ceil() of arguments less than one in magnitude
+static void check_floor_ceil()
+	{
+	float_precision x( "-0.0001", 30 ), y( "0.0001", 30 );
+
+	check( floor( x ) == float_precision( "-1" ), "floor(-0.0001)==-1" );
+	check( ceil( x ) == float_precision( "0" ), "ceil(-0.0001)==0" );
+	check( floor( y ) == float_precision( "0" ), "floor(0.0001)==0" );
+	check( ceil( y ) == float_precision( "1" ), "ceil(0.0001)==1" );
+	check( float_precision( -7, 10 ) == float_precision( "-7", 10 ), "float_precision(-7)==-7" );
+	}
+
+// fma(), sum() and dot() of operands with different precisions and exponents. The results are rounded once to the max precision
+static void check_fma_sum_dot()
+	{
+	std::string nines( 40, '9' );
+	float_precision a( "1E-30", 20 ), b( "1", 20 ), c( "1.2345", 20 );
+
+	check( fma( a, b, c ) == float_precision( "1.2345", 20 ), "fma(1E-30,1,1.2345)==1.2345" );
+	a = float_precision( "1.0000000001E-30", 20 );
+	c = float_precision( "1.23456789012345678", 20 );
+	check( fma( a, b, c ) == float_precision( "1.23456789012345678", 20 ), "fma(1.0000000001E-30,1,1.23456789012345678)==1.23456789012345678" );
+	a.precision( 40 ); b.precision( 40 ); c.precision( 40 );
+	a = float_precision( "-4E-23", 40 );
+	b = float_precision( "-6E-21", 40 );
+	c = float_precision( "9." + nines.substr( 1 ) + "E16", 40 );
+	check( fma( a, b, c ) == c, "fma(-4E-23,-6E-21,9.99..9E16)==9.99..9E16" );
+
+	// The exact product has 40 digits, the addend 5 and the result is rounded to 20 digits
+	float_precision x( "1." + nines.substr( 21 ), 20 ), y( "1." + nines.substr( 21 ), 20 ), z( "-1", 5 );
+	float_precision r = fma( x, y, z );
+	check( r == float_precision( "2.9999999999999999996", 20 ) && r.precision() == 20, "fma(1.99..9,1.99..9,-1) of mixed precisions" );
+
+	std::vector<float_precision> v;
+	v.push_back( float_precision( "1E30", 5 ) );
+	v.push_back( float_precision( "1.5E-30", 40 ) );
+	v.push_back( float_precision( "1", 10 ) );
+	v.push_back( float_precision( "-1E30", 5 ) );
+	check( sum( v ) == float_precision( "1.0000000000000000000000000000015", 40 ), "sum(1E30,1.5E-30,1,-1E30)" );
+
+	std::vector<float_precision> w( v.size(), float_precision( "3", 5 ) );
+	w[1] = float_precision( "2E-9", 20 );
+	check( dot( v, w ) == float_precision( "3.000000000000000000000000000000000000003", 40 ), "dot((1E30,1.5E-30,1,-1E30),(3,2E-9,3,3))" );
+	}
+
+// _float_table_load() accept a file written by _float_table_save() and ignore a file with a wrong or unreadable constant
+static void check_table_load()
+	{
+	static const char *file = "check.constants";
+	static const char *corrupt[] = { "pi 100 3.1415926535897932394626433832795028841971693993751058209749445923078164062862089986280348253421170679\n",
+		"pi 100 3.14abc\n", "pi 100000 3.14159265358979323846\n", "tau 100 6.28\n", "pi x\n" };
+	const float_precision pi( "3.1415926535897932384626433832795028841971693993751058209749445923078164062862089986280348253421170679", 100 );
+	FILE *fp;
+	char what[64];
+
+	_float_table( _PI, 100 );
+	check( _float_table_save( file ) && _float_table_load( file ), "_float_table_load() of a saved file" );
+	for( unsigned int i = 0; i < sizeof( corrupt ) / sizeof( corrupt[0] ); ++i )
+		{
+		if( ( fp = fopen( file, "w" ) ) == NULL )
+			break;
+		fputs( corrupt[i], fp );
+		fclose( fp );
+		sprintf( what, "_float_table_load() ignore corrupt file %u", i + 1 );
+		check( !_float_table_load( file ) && _float_table( _PI, 100 ) == pi, what );
+		}
+	remove( file );
+	}
+
+// int_precision::leading_digits() and float_precision::leading_digits() round to nearest and take at least one digit
+static void check_leading_digits()
+	{
+	int expo;
+
+	check( int_precision( "123456" ).leading_digits( 3, &expo ) == "123" && expo == 5, "leading_digits(123456,3)==123" );
+	check( int_precision( "99951" ).leading_digits( 3, &expo ) == "1" && expo == 5, "leading_digits(99951,3)==1" );
+	check( int_precision( "96" ).leading_digits( 0, &expo ) == "1" && expo == 2, "leading_digits(96,0)==1" );
+	check( int_precision( "-42" ).leading_digits( (unsigned int)-1, &expo ) == "42" && expo == 1, "leading_digits(-42,UINT_MAX)==42" );
+	check( float_precision( "123.456", 20 ).leading_digits( (unsigned int)-1, &expo ) == "123456" && expo == 2, "leading_digits(123.456,UINT_MAX)==123456" );
+	check( float_precision( "4.56", 20 ).leading_digits( 0, &expo ) == "5" && expo == 0, "leading_digits(4.56,0)==5" );
+	check( float_precision( "9.9951", 20 ).leading_digits( 3, &expo ) == "1" && expo == 1, "leading_digits(9.9951,3)==1" );
+	}
+
+// fraction_precision::reduce() of an unreduced product leave a normalized fraction
+static void check_fraction_reduce()
+	{
+	fraction_precision<int_precision> a( int_precision( -7 ), int_precision( 3 ) ), b( int_precision( 6 ), int_precision( 5 ) );
+
+	a *= b;
+	check( a.reduce() == int_precision( -2 ) && a.numerator() == int_precision( -4 ) && a.denominator() == int_precision( 5 ), "(-7/3*6/5).reduce()==-2 and -4/5" );
+	}
+
+int main()
+	{
+	check_exp();
+	check_floor_ceil();
+	check_fma_sum_dot();
+	check_table_load();
+	check_leading_digits();
+	check_fraction_reduce();
+	printf( "%d checks, %d failed\n", checks, failures );
+	return failures ? 1 : 0;
+	}
@@ -0,0 +1,283 @@
+/*
+ *******************************************************************************
+ *
+ *
+ * Module name     :   tune.cpp
+ * Module ID Nbr   :
+ * Description     :   Measure the crossover thresholds between the int_precision
+ *                     multiplication, division and gcd algorithms, the binary splitting
+ *                     series of the float_precision elementary functions and the arithmetic
+ *                     geometric mean of log() on the machine it runs on
+ * --------------------------------------------------------------------------
+ * Change Record   :
+ *
+ * Version	Author/Date		Description of changes
+ * -------  ---------------	----------------------
+ * 01.01	agent/16-OCT-2026	Initial release
+ * 01.02	agent/16-OCT-2026	Also measure the Newton division threshold
+ * 01.03	agent/16-OCT-2026	Also measure the half gcd threshold
+ * 01.04	agent/16-OCT-2026	Also measure the binary splitting series threshold
+ * 01.05	agent/16-OCT-2026	Also measure the arithmetic geometric mean threshold of log()
+ * 01.06	agent/16-OCT-2026	log() has no binary splitting series so the arithmetic geometric mean is measured against the Taylor series
+ *
+ * End of Change Record
+ * --------------------------------------------------------------------------
+*/
+
+// Usage: tune [file]
+// The measured thresholds are written to file (default precision.tune) in the format precision_ctrl::load_thresholds()
+// read and a replacement for src/precision/precisiontune.h is written to stdout. Copy the file to the data directory
+// of the calculator to use the thresholds at startup or replace precisiontune.h to make them the compiled in defaults.
+// Progress is written to stderr.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <string>
+
+#include "precision/iprecision.h"
+#include "precision/fprecision.h"
+
+static const size_t NEVER = (size_t)-1 / 2;	// A threshold that is never reached
+
+// Return a random number of n digits
+static std::string random_digits( size_t n )
+	{
+	std::string s( n, ICHARACTER( 0 ) );
+
+	for( size_t i = 0; i < n; ++i )
+		s[i] = ICHARACTER( (char)( rand() % RADIX ) );
+	s[0] = ICHARACTER( (char)( 1 + rand() % ( RADIX - 1 ) ) );
+	return s;
+	}
+
+// Return the fastest time in seconds of one call to f(a,b). Each sample is repeated until it takes at least 20ms
+static double measure( std::string (*f)( std::string *, std::string * ), std::string& a, std::string& b )
+	{
+	double best = 1e30;
+
+	for( int sample = 0; sample < 3; ++sample )
+		{
+		int reps = 0;
+		clock_t start = clock(), stop;
+
+		do
+			{
+			f( &a, &b );
+			++reps;
+			stop = clock();
+			} while( stop - start < CLOCKS_PER_SEC / 50 );
+		double t = (double)( stop - start ) / CLOCKS_PER_SEC / reps;
+		if( t < best )
+			best = t;
+		}
+	return best;
+	}
+
+// The limb multiplication with the thresholds currently in precision_ctrl
+static std::string limb_mul( std::string *a, std::string *b )
+	{
+	return _int_precision_umul( a, b );
+	}
+
+// Divide a 2n digit number with the n digit number b
+static std::string limb_div( std::string *a, std::string *b )
+	{
+	std::string u = *a + *b;
+	return _int_precision_udiv( &u, b );
+	}
+
+// The gcd of two n digit numbers
+static std::string limb_gcd( std::string *a, std::string *b )
+	{
+	return gcd( int_precision( *a ), int_precision( *b ) ).toString();
+	}
+
+// Return the fastest time in seconds of one call to f(x). Each sample is repeated until it takes at least 20ms
+static double measure_fn( float_precision (*f)( const float_precision& ), const float_precision& x )
+	{
+	double best = 1e30;
+
+	for( int sample = 0; sample < 3; ++sample )
+		{
+		int reps = 0;
+		clock_t start = clock(), stop;
+
+		do
+			{
+			f( x );
+			++reps;
+			stop = clock();
+			} while( stop - start < CLOCKS_PER_SEC / 50 );
+		double t = (double)( stop - start ) / CLOCKS_PER_SEC / reps;
+		if( t < best )
+			best = t;
+		}
+	return best;
+	}
+
+// Find the smallest number of limbs from where the algorithm enabled by set(n) beat the one below it.
+// set(n) make the top level of a n limb operation f use the faster algorithm and set(NEVER) disable it.
+// Two consecutive wins are required to avoid noise
+static size_t find_limb_threshold( const char *name, size_t (precision_ctrl::*set)( size_t ), std::string (*f)( std::string *, std::string * ), size_t from, size_t to )
+	{
+	int wins = 0;
+	size_t n, first = to;
+
+	for( n = from; n <= to; n += n / 8 > 1 ? n / 8 : 1 )
+		{
+		std::string a = random_digits( n * ILIMB_DIGITS ), b = random_digits( n * ILIMB_DIGITS );
+		( precision_ctrl.*set )( NEVER );
+		double slow = measure( f, a, b );
+		( precision_ctrl.*set )( n );
+		double fast = measure( f, a, b );
+		fprintf( stderr, "%-10s %6lu limbs %10.2fus %10.2fus\n", name, (unsigned long)n, slow * 1e6, fast * 1e6 );
+		if( fast < slow )
+			{
+			if( wins++ == 0 )
+				first = n;
+			if( wins == 2 )
+				break;
+			}
+		else
+			wins = 0;
+		}
+	( precision_ctrl.*set )( first );
+	return first;
+	}
+
+// Find the number of digits from where fast beat slow. Two consecutive wins are required to avoid noise
+static size_t find_digit_threshold( const char *name, std::string (*slow_mul)( std::string *, std::string * ), std::string (*fast_mul)( std::string *, std::string * ), size_t from, size_t to )
+	{
+	int wins = 0;
+	size_t n, first = to;
+
+	for( n = from; n <= to; n += n / 4 )
+		{
+		std::string a = random_digits( n ), b = random_digits( n );
+		double slow = measure( slow_mul, a, b );
+		double fast = measure( fast_mul, a, b );
+		fprintf( stderr, "%-10s %6lu digits %10.2fus %10.2fus\n", name, (unsigned long)n, slow * 1e6, fast * 1e6 );
+		if( fast < slow )
+			{
+			if( wins++ == 0 )
+				first = n;
+			if( wins == 2 )
+				break;
+			}
+		else
+			wins = 0;
+		}
+	return first;
+	}
+
+// Find the precision from where exp() with the binary splitting series beat the Taylor series. Two consecutive wins are required to avoid noise
+static size_t find_series_threshold( size_t from, size_t to )
+	{
+	int wins = 0;
+	size_t n, first = to;
+
+	for( n = from; n <= to; n += n / 4 )
+		{
+		float_precision x( "1.2345678901234567890123456789", (unsigned int)n, ROUND_NEAR );
+		precision_ctrl.series_threshold( NEVER );
+		double slow = measure_fn( exp, x );
+		precision_ctrl.series_threshold( n );
+		double fast = measure_fn( exp, x );
+		fprintf( stderr, "%-10s %6lu digits %10.2fus %10.2fus\n", "series", (unsigned long)n, slow * 1e6, fast * 1e6 );
+		if( fast < slow )
+			{
+			if( wins++ == 0 )
+				first = n;
+			if( wins == 2 )
+				break;
+			}
+		else
+			wins = 0;
+		}
+	precision_ctrl.series_threshold( first );
+	return first;
+	}
+
+// Find the precision from where log() with the arithmetic geometric mean beat the Taylor series. Two consecutive wins are required to avoid noise
+static size_t find_agm_threshold( size_t from, size_t to )
+	{
+	int wins = 0;
+	size_t n, first = to;
+
+	for( n = from; n <= to; n += n / 4 )
+		{
+		float_precision x( "1.2345678901234567890123456789", (unsigned int)n, ROUND_NEAR );
+		precision_ctrl.agm_threshold( NEVER );
+		double slow = measure_fn( log, x );
+		precision_ctrl.agm_threshold( n );
+		double fast = measure_fn( log, x );
+		fprintf( stderr, "%-10s %6lu digits %10.2fus %10.2fus\n", "agm", (unsigned long)n, slow * 1e6, fast * 1e6 );
+		if( fast < slow )
+			{
+			if( wins++ == 0 )
+				first = n;
+			if( wins == 2 )
+				break;
+			}
+		else
+			wins = 0;
+		}
+	precision_ctrl.agm_threshold( first );
+	return first;
+	}
+
+// The fastest of the two transform based multiplications
+static std::string transform_mul( std::string *a, std::string *b )
+	{
+	return a->length() >= precision_ctrl.mul_ntt_threshold() ? _int_precision_umul_ntt( a, b ) : _int_precision_umul_fourier( a, b );
+	}
+
+int main( int argc, char *argv[] )
+	{
+	const char *file = argc > 1 ? argv[1] : "precision.tune";
+
+	srand( 1 );
+
+	// Karatsuba against schoolbook with Toom-Cook disabled, then Toom-Cook against Karatsuba
+	precision_ctrl.toom3_threshold( NEVER );
+	size_t karatsuba = find_limb_threshold( "karatsuba", &precision_ctrl::karatsuba_threshold, limb_mul, 8, 200 );
+	size_t toom3 = find_limb_threshold( "toom3", &precision_ctrl::toom3_threshold, limb_mul, 2 * karatsuba, 2000 );
+
+	// NTT against FFT and then the limb multiplication against the fastest transform
+	size_t ntt = find_digit_threshold( "ntt", _int_precision_umul_fourier, _int_precision_umul_ntt, 1000, 500000 );
+	precision_ctrl.mul_ntt_threshold( ntt );
+	size_t limb = find_digit_threshold( "limb", limb_mul, transform_mul, 1000, 500000 );
+	precision_ctrl.mul_limb_threshold( limb );
+
+	// Newton division against long division of 2n by n limbs
+	size_t div_newton = find_limb_threshold( "div_newton", &precision_ctrl::div_newton_threshold, limb_div, 16, 8000 );
+
+	// Half gcd against Lehmer steps
+	size_t gcd_hgcd = find_limb_threshold( "gcd_hgcd", &precision_ctrl::gcd_hgcd_threshold, limb_gcd, 100, 8000 );
+
+	// Binary splitting series against the Taylor series in the float_precision elementary functions
+	size_t series = find_series_threshold( 50, 5000 );
+
+	// The arithmetic geometric mean against the Taylor series in log(). Newton iterations on log() in exp() is only
+	// faster than the binary splitting series at very high precision so that threshold is not measured
+	size_t agm = find_agm_threshold( 30, 5000 );
+
+	if( !precision_ctrl.save_thresholds( file ) )
+		fprintf( stderr, "Could not write %s\n", file );
+
+	printf( "#ifndef INC_PRECISIONTUNE\n#define INC_PRECISIONTUNE\n\n" );
+	printf( "// Generated by the tune program\n\n" );
+	printf( "static const size_t IKARATSUBA_THRESHOLD = %lu;		// Minimum number of limbs before the limb multiplication use Karatsuba\n", (unsigned long)karatsuba );
+	printf( "static const size_t ITOOM3_THRESHOLD = %lu;			// Minimum number of limbs before the limb multiplication use Toom-Cook 3 way\n", (unsigned long)toom3 );
+	printf( "static const size_t IMUL_LIMB_THRESHOLD = %lu;	// Below this number of digits in the smallest operand *= use the limb multiplication instead of FFT\n", (unsigned long)limb );
+	printf( "static const size_t IMUL_NTT_THRESHOLD = %lu;		// From this number of digits in the smallest operand *= use the number theoretic transform instead of FFT\n", (unsigned long)ntt );
+	printf( "static const size_t IDIV_NEWTON_THRESHOLD = %lu;		// Minimum number of limbs in the divisor and the quotient before division use Newton reciprocal and Barrett reduction\n", (unsigned long)div_newton );
+	printf( "static const size_t IGCD_HGCD_THRESHOLD = %lu;		// Minimum number of limbs before gcd() use the half gcd instead of Lehmer steps\n", (unsigned long)gcd_hgcd );
+	printf( "static const size_t FSERIES_THRESHOLD = %lu;		// From this precision exp(), sin(), cos() and atan() use binary splitting series\n", (unsigned long)series );
+	printf( "static const size_t FAGM_THRESHOLD = %lu;			// From this precision log() use the arithmetic geometric mean instead of the Taylor series\n", (unsigned long)agm );
+	printf( "static const size_t FEXP_NEWTON_THRESHOLD = %lu;	// From this precision exp() use Newton iterations on log() instead of the binary splitting series\n", (unsigned long)precision_ctrl.exp_newton_threshold() );
+	printf( "\n#endif\n" );
+
+	return 0;
+	}
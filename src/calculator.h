@@ -5,6 +5,7 @@
 
 #include <stack>
 #include <functional>
+#include <utility>
 
 #include "precision/iprecision.h"
 #include "precision/fprecision.h"
@@ -197,7 +198,7 @@ namespace calc
   public:
     Calculator() : _value(0.0f), _hasMemory(false), _memory(0) { }
 
-    void set(value_t value) { _value = value; }
+    void set(value_t value) { _value = std::move(value); }
     const value_t& value() const { return _value; }
     value_t& value() { return _value; }
 
@@ -208,29 +209,30 @@ namespace calc
 
     void pushOperator(binary_operator_t op)
     {
-      _operators.push(op);
+      _operators.push(std::move(op));
     }
 
     void apply(const unary_operator_t& op)
     {
-      _value = op(_value);
+      _value = op(std::move(_value));
     }
 
     void applyFromStack()
     {
       if (!_operators.empty() && !_stack.empty())
       {
-        auto op = _operators.top();
+        auto op = std::move(_operators.top());
         _operators.pop();
-        _value = op(_stack.top(), _value);
+        _value = op(std::move(_stack.top()), std::move(_value));
         _stack.pop();
       }
     }
 
     void clearStacks()
     {
-      _stack = std::stack<value_t>();
-      _operators = std::stack<binary_operator_t>();
+      /* pop instead of constructing new stacks to keep the storage they already have */
+      while (!_stack.empty()) _stack.pop();
+      while (!_operators.empty()) _operators.pop();
     }
 
     void clearMemory()
@@ -248,7 +250,7 @@ namespace calc
     void setMemory(value_t value)
     {
       _hasMemory = true;
-      _memory = value;
+      _memory = std::move(value);
     }
 
     bool hasMemory() const { return _hasMemory; }
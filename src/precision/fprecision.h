@@ -81,13 +81,27 @@
  * 01.33	HVE/JUL-30-2019	Added the method .toPrecision(), .toExponential() with same functionality as in Javascript
  * 02.00	HVE/SEP-13-2019 Version2. change in the class variable. Sign has been separated from Mantissa.
  * 02.01	HVE/17-Sep-2019	Further optimization of the code. 
+ * 02.02	agent/16-Oct-2026	Mantissa subtraction and multiplication now use the int_precision limb kernels (_INT_PRECISION_LIMB_KERNELS)
+ * 02.03	agent/16-Oct-2026	*= use the runtime precision_ctrl.mul_limb_threshold() instead of FMUL_LIMB_THRESHOLD
+ * 02.04	agent/16-Oct-2026	Added the method .leading_digits(). .toPrecision() only convert the digits it needs
+ * 02.05	agent/16-Oct-2026	Added move constructor, move assignment and operator+,-,*,/ for a temporary left hand side that reuse its mantissa.
+ *							The binary operators no longer copy the result of the compound assignment
+ * 02.06	agent/16-Oct-2026	Small value fast path in +=, *= and /= with native 64bit arithmetic when the mantissas are short
+ * 02.07	agent/16-Oct-2026	Added _float_table_load() and _float_table_save()
+ * 02.08	agent/16-Oct-2026	*= use the short product _float_precision_umul_high() below precision_ctrl.mul_limb_threshold() digits
+ * 02.09	agent/16-Oct-2026	+= and -= share add_signed() so -= no longer copy its operand. The aligned mantissas are build once
+ *							with room for the alignment and the results of +=, *= and the constructors are swapped into the mantissa
+ * 02.10	agent/16-Oct-2026	Added fma(), sum() and dot() with a single rounding
+ * 02.11	agent/16-Oct-2026	float_precision(int) converted a negative integer through unsigned
+ * 02.12	agent/16-Oct-2026	Added a const ref_mantissa()
+ * 02.13	agent/16-Oct-2026	.leading_digits() take the leading digits with a size_t count so n = UINT_MAX does not wrap
  *
  * End of Change Record
  * --------------------------------------------------------------------------
 */
 
 /* define version string */
-static char _VF_[] = "@(#)fprecision.h 02.01 -- Copyright (C) Henrik Vestermark";
+static char _VF_[] = "@(#)fprecision.h 02.13 -- Copyright (C) Henrik Vestermark";
 
 #include <algorithm>
 #include "iprecision.h"
@@ -164,6 +178,7 @@ template <class _Ty> inline float_precision operator+( const _Ty&, const float_p
 inline float_precision operator+( int_precision&, float_precision& );					// Override int_precision - other type in iprecision.h
 //inline float_precision operator+( float_precision&,int_precision&);					// Override int_precision - other type in iprecision.h
 inline float_precision operator+( const float_precision& );								// Unary
+inline float_precision operator+( float_precision&&, const float_precision& );					// Reuse the mantissa of a temporary lhs
 //float_precision operator+( float_precision&, float_precision& );			// Binary. Obsolete
 
 // Arithmetic - Binary and Unary
@@ -172,17 +187,20 @@ template <class _Ty> inline float_precision operator-(const _Ty&, const float_pr
 inline float_precision operator-(int_precision&, float_precision&);						// Override int_precision - other type in iprecision.h
 //inline float_precision operator-( const float_precision&, const float_precision& );	// Binary. Obsolete
 inline float_precision operator-( const float_precision& );								// Unary
+inline float_precision operator-( float_precision&&, const float_precision& );					// Reuse the mantissa of a temporary lhs
 
 // Arithmetic * Binary
 template <class _Ty> inline float_precision operator*(float_precision&, const _Ty&);
 template <class _Ty> inline float_precision operator*(const _Ty&, const float_precision&);
 inline float_precision operator*(int_precision&, float_precision&);						// Override int_precision * other type in iprecision.h
+inline float_precision operator*( float_precision&&, const float_precision& );					// Reuse the mantissa of a temporary lhs
 //inline static float_precision operator*( const float_precision&, const float_precision& );  // Binary. Obsolete
 
 // Arithmetic / Binary
 template <class _Ty> inline float_precision operator/(float_precision&, const _Ty&);
 template <class _Ty> inline float_precision operator/(const _Ty&, const float_precision&);
 inline float_precision operator/(int_precision&, float_precision&);						// Override int_precision / other type in iprecision.h
+inline float_precision operator/( float_precision&&, const float_precision& );					// Reuse the mantissa of a temporary lhs
 //inline float_precision operator/( const float_precision&, const float_precision& );		// Binary. Obsolete
 
 // Boolean Comparision Operators
@@ -228,9 +246,18 @@ extern float_precision atanh( const float_precision& );
 // Miscelanneous support function
 extern float_precision nroot(const float_precision&, unsigned int);
 
+// Fused multiply add and sums that are only rounded once
+extern float_precision fma( const float_precision&, const float_precision&, const float_precision& );
+extern float_precision sum( const float_precision *, size_t );
+extern float_precision sum( const std::vector<float_precision>& );
+extern float_precision dot( const float_precision *, const float_precision *, size_t );
+extern float_precision dot( const std::vector<float_precision>&, const std::vector<float_precision>& );
+
 // Support functions. Works on float_precision
 float_precision _float_precision_inverse( const float_precision& );
 float_precision _float_table( enum table_type, unsigned int );
+bool _float_table_load( const char * );
+bool _float_table_save( const char * );
 std::string _float_precision_ftoa( const float_precision * );
 std::string _float_precision_ftoainteger( const float_precision * );
 float_precision _float_precision_atof( const char *, unsigned int, enum round_mode );
@@ -250,10 +277,14 @@ std::string _float_precision_usub_short( int *, std::string *, unsigned int );
 std::string _float_precision_usub( int *, std::string *, std::string * );
 std::string _float_precision_umul_short( std::string *, unsigned int );
 std::string _float_precision_umul( std::string *, std::string * );
+std::string _float_precision_umul_high( std::string *, std::string *, unsigned int, int * );
 std::string _float_precision_umul_fourier( std::string *, std::string * );
 std::string _float_precision_udiv_short( unsigned int *, std::string *, unsigned int );
 std::string _float_precision_udiv( std::string *, std::string * );
 std::string _float_precision_urem( std::string *, std::string * );
+bool _float_precision_add64( std::string *, int *, int *, const std::string *, int, int, const std::string *, int, int );	// Small value fast path for +=
+std::string _float_precision_umul64( std::string *, std::string * );
+bool _float_precision_div64( std::string *, int *, const std::string *, int, const std::string *, int, unsigned int );	// Small value fast path for /=
 
 ///
 /// @class float_precision
@@ -280,6 +311,8 @@ class float_precision {
    std::string       mNumber; // The mantissa any length however the fraction point is always after the first digit and is implied
    int				 mSign;	  // The sign +1 for "+"a and -1 for "-". Notice in version 2+ the sign has been separated frm the mNumber, same as for int_precision
 
+   float_precision& add_signed( const float_precision&, int );	// *this += a with the sign of a replaced. Used by += and -=
+
    public:
       // Constructors
 	  float_precision()							{ 
@@ -303,11 +336,13 @@ class float_precision {
       float_precision( const char *, unsigned int, enum round_mode );		// When initialized through a char string
 	  float_precision( const std::string&, unsigned int, enum round_mode);	// When initialized through a std::string
       float_precision( const float_precision& s ): mNumber(s.mNumber), mRmode(s.mRmode), mPrec(s.mPrec), mExpo(s.mExpo), mSign(s.mSign) {}  // When initialized through another float_precision
+      float_precision( float_precision&& s ): mNumber(std::move(s.mNumber)), mRmode(s.mRmode), mPrec(s.mPrec), mExpo(s.mExpo), mSign(s.mSign) { s.mNumber = FCHARACTER(0); s.mExpo = 0; s.mSign = +1; }  // Take over the mantissa of a temporary and leave it as 0
       float_precision( const int_precision&, unsigned int, enum round_mode );
 
       // Coordinate functions
       std::string get_mantissa() const             { return mNumber.substr(); };    // Copy of mantissa
       std::string *ref_mantissa()                  { return &mNumber; }				// Reference to Mantissa
+      const std::string *ref_mantissa() const      { return &mNumber; }				// Read only reference to Mantissa
       enum round_mode mode() const                 { return mRmode; }
       enum round_mode mode( enum round_mode m )    { return( mRmode = m ); }
       int exponent() const                         { return mExpo; };
@@ -334,6 +369,7 @@ class float_precision {
 	  std::string toFixed(int );
 	  std::string toPrecision(int) const;
 	  std::string toExponential(int) const;
+	  std::string leading_digits( unsigned int, int * ) const;
 
 	  // Implicit/explicit conversion operators
       operator char() const;
@@ -350,6 +386,7 @@ class float_precision {
 
       // Essential operators
       float_precision& operator= ( const float_precision& );
+      float_precision& operator= ( float_precision&& );
       float_precision& operator+=( const float_precision& );
       float_precision& operator-=( const float_precision& );
       float_precision& operator*=( const float_precision& );
@@ -411,7 +448,7 @@ inline float_precision::float_precision( const char c, unsigned int p = float_pr
 		mExpo = (int)number.length() -1;                   // Always one digit before the dot
 		_float_precision_strip_trailing_zeros( &number );  // Get rid of trailing non-significant zeros
 		mExpo += _float_precision_rounding( &number, mSign, mPrec, mRmode );    // Perform rounding
-		mNumber = number;								// Build number
+		mNumber.swap( number );								// Build number
 		}
 	}
 
@@ -449,7 +486,7 @@ inline float_precision::float_precision( const unsigned char c, unsigned int p =
 		mExpo = (int)number.length() -1;                   // Always one digit before the dot
 		_float_precision_strip_trailing_zeros( &number );  // Get rid of trailing non-significant zeros
 		mExpo += _float_precision_rounding( &number, mSign, mPrec, mRmode );    // Perform rounding
-		mNumber = number;									// Build number
+		mNumber.swap( number );									// Build number
 		}
 	}
 
@@ -485,7 +522,7 @@ inline float_precision::float_precision( short i, unsigned int p = float_precisi
 	mExpo = (int)number.length() -1;                   // Always one digit before the dot
 	_float_precision_strip_trailing_zeros( &number );  // Get rid of trailing non-significant zeros
 	mExpo += _float_precision_rounding( &number, mSign, mPrec, mRmode );    // Perform rounding
-	mNumber = number;									// Build number
+	mNumber.swap( number );									// Build number
 	}
 
 
@@ -521,7 +558,7 @@ inline float_precision::float_precision( unsigned short i, unsigned int p = floa
 	mExpo = (int)number.length() -1;                   // Always one digit before the dot
 	_float_precision_strip_trailing_zeros( &number );  // Get rid of trailing non-significant zeros
 	mExpo += _float_precision_rounding( &number, mSign, mPrec, mRmode );    // Perform rounding
-	mNumber = number;									// Build number
+	mNumber.swap( number );									// Build number
 	}
 
 
@@ -550,14 +587,14 @@ inline float_precision::float_precision( int i, unsigned int p = float_precision
 	mPrec = p;
 	mExpo = 0;
 
-	number = ito_precision_string( (unsigned)i, true, F_RADIX );          // Convert to integer
+	number = ito_precision_string( (long)i, true, F_RADIX );              // Convert to integer
 	mSign = CHAR_SIGN( number[0] );;                    // Get Sign
 	number = number.substr( 1 );                       // Remove sign
 	_float_precision_strip_leading_zeros( &number );   // First strip for leading zeros
 	mExpo = (int)number.length() -1;                   // Always one digit before the dot
 	_float_precision_strip_trailing_zeros( &number );  // Get rid of trailing non-significant zeros
 	mExpo += _float_precision_rounding( &number, mSign, mPrec, mRmode );    // Perform rounding
-	mNumber = number;									// Build number
+	mNumber.swap( number );									// Build number
 	}
 
 
@@ -593,7 +630,7 @@ inline float_precision::float_precision( unsigned int i, unsigned int p = float_
 	mExpo = (int)number.length() -1;                   // Always one digit before the dot
 	_float_precision_strip_trailing_zeros( &number );  // Get rid of trailing non-significant zeros
 	mExpo += _float_precision_rounding( &number, mSign, mPrec, mRmode );    // Perform rounding
-	mNumber = number;									// Build number
+	mNumber.swap( number );									// Build number
 	}
 
 
@@ -629,7 +666,7 @@ inline float_precision::float_precision( long i, unsigned int p = float_precisio
 	mExpo = (int)number.length() -1;                   // Always one digit before the dot
 	_float_precision_strip_trailing_zeros( &number );  // Get rid of trailing non-significant zeros
 	mExpo += _float_precision_rounding( &number, mSign, mPrec, mRmode );    // Perform rounding
-	mNumber = number;            // Build number
+	mNumber.swap( number );            // Build number
 	}
 
 
@@ -665,7 +702,7 @@ inline float_precision::float_precision( unsigned long i, unsigned int p = float
 	mExpo = (int)number.length() -1;                   // Always one digit before the dot
 	_float_precision_strip_trailing_zeros( &number );  // Get rid of trailing non-significant zeros
 	mExpo += _float_precision_rounding( &number, mSign, mPrec, mRmode );    // Perform rounding
-	mNumber = number;									// Build number
+	mNumber.swap( number );									// Build number
 	}
 
 ///	@author Henrik Vestermark (hve@hvks.com)
@@ -700,7 +737,7 @@ inline float_precision::float_precision( int64_t i, unsigned int p = float_preci
 	mExpo = (int)number.length() - 1;                // Always one digit before the dot
 	_float_precision_strip_trailing_zeros(&number);  // Get rid of trailing non-significant zeros
 	mExpo += _float_precision_rounding(&number, mSign, mPrec, mRmode);    // Perform rounding
-	mNumber = number;								// Build number
+	mNumber.swap( number );								// Build number
 	}
 
 
@@ -735,7 +772,7 @@ inline float_precision::float_precision( uint64_t i, unsigned int p = float_prec
 	mExpo = (int)number.length() - 1;					// Always one digit before the dot
 	_float_precision_strip_trailing_zeros(&number);		// Get rid of trailing non-significant zeros
 	mExpo += _float_precision_rounding(&number, mSign, mPrec, mRmode);    // Perform rounding
-	mNumber = number;									// Build number
+	mNumber.swap( number );									// Build number
 	}
 
 ///	@author Henrik Vestermark (hve@hvks.com)
@@ -1059,7 +1096,33 @@ inline float_precision& float_precision::operator=( const float_precision& a )
    {
    mExpo = a.mExpo;
    mSign = a.mSign;
-   mNumber = a.mNumber.substr();
+   mNumber = a.mNumber;		// Reuse the buffer of the left hand side when it is large enough
+   if( _float_precision_rounding( &mNumber, mSign, mPrec, mRmode ) != 0 )  // Round back to left hand side precision
+      mExpo++;
+
+   return *this;
+   }
+
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	Assign a temporary float precision number
+///	@return 	float_precision&	-
+///	@param   "a"	-	float precsion number to assign
+///
+///	@todo
+///
+/// Description:
+///   Move assign operator
+///   Same as the assign operator except the mantissa of a is swapped with the left hand side
+///   instead of being copied. a keeps a valid number
+///   Mode and precision is not affected by the assignment.
+//
+inline float_precision& float_precision::operator=( float_precision&& a )
+   {
+   std::swap( mExpo, a.mExpo );
+   std::swap( mSign, a.mSign );
+   mNumber.swap( a.mNumber );
    if( _float_precision_rounding( &mNumber, mSign, mPrec, mRmode ) != 0 )  // Round back to left hand side precision
       mExpo++;
 
@@ -1091,7 +1154,26 @@ inline float_precision& float_precision::operator=( const float_precision& a )
 //
 inline float_precision& float_precision::operator+=( const float_precision& a )
 	{
-	int sign, sign1, sign2, wrap;
+	return add_signed( a, a.mSign );
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	Add a float precision number with a given sign
+///	@return 	the resulting float_precision number
+///	@param   "a"	-	float precsion number to add
+///	@param   "sign1"	-	The sign to use for a
+///
+///	@todo
+///
+/// Description:
+///   The body of += and -=. -= call it with the sign of a changed so a does not need to be copied
+///   The aligned mantissas are build in strings that has room for the alignment so they are only allocated once
+///   and the result is swapped into the mantissa of *this instead of copied
+//
+inline float_precision& float_precision::add_signed( const float_precision& a, int sign1 )
+	{
+	int sign, sign2, wrap;
 	int expo_max, digits_max;
 	unsigned int precision_max;
 	std::string s, s1, s2;
@@ -1099,23 +1181,40 @@ inline float_precision& float_precision::operator+=( const float_precision& a )
 	if( a.mNumber.length() == 1 && FDIGIT( a.mNumber[0] ) == 0 )  // Add zero
 		return *this;
 	if( mNumber.length() == 1 && FDIGIT( mNumber[0] ) == 0 )      // Add a (not zero) to *this (is zero) Same as *this = a;
-		return *this = a;
+		{
+		mExpo = a.mExpo;
+		mSign = sign1;
+		mNumber = a.mNumber;
+		if( _float_precision_rounding( &mNumber, mSign, mPrec, mRmode ) != 0 )  // Round back to left hand side precision
+			mExpo++;
+		return *this;
+		}
+
+	// Small value fast path. Both operands aligned fit in a 64bit integer. The sum is exact so only the final rounding is needed
+	if( _float_precision_add64( &mNumber, &expo_max, &sign, &a.mNumber, a.mExpo, sign1, &mNumber, mExpo, mSign ) )
+		{
+		if( _float_precision_rounding( &mNumber, sign, mPrec, mRmode ) != 0 )  // Round back left hand side precision
+			expo_max++;
+		mSign = sign;
+		mExpo = expo_max;
+		return *this;
+		}
 
 	// extract sign and unsigned portion of number
-	sign1 = a.mSign;
-	s1 = a.mNumber.substr();		// Extract Mantissa
 	sign2 = mSign;
-	s2 = mNumber.substr();			// Extract Mantissa
 	expo_max = std::max( mExpo, a.mExpo );
 	precision_max = std::max( mPrec, a.mPrec );
 
 	// Check if add makes sense. Still missing
 
-	// Right shift (padd leading zeros) to the smallest number
-	if( a.mExpo != expo_max )
-		_float_precision_right_shift( &s1, expo_max - a.mExpo );
-	if( mExpo != expo_max )
-		_float_precision_right_shift( &s2, expo_max - mExpo );
+	// Extract the mantissas right shifted (padd leading zeros) to the smallest number. Room for the alignment and a carry is reserved
+	digits_max = (int)std::max( expo_max - a.mExpo + a.mNumber.length(), expo_max - mExpo + mNumber.length() ) + 1;
+	s1.reserve( digits_max );
+	s1.assign( expo_max - a.mExpo, FCHARACTER( 0 ) );
+	s1 += a.mNumber;
+	s2.reserve( digits_max );
+	s2.assign( expo_max - mExpo, FCHARACTER( 0 ) );
+	s2 += mNumber;
 
 	// Round to same precision
 	if( _float_precision_rounding( &s1, sign1, precision_max, a.mode() ) != 0 ) // If carry when rounding up then one right shift
@@ -1166,7 +1265,7 @@ inline float_precision& float_precision::operator+=( const float_precision& a )
 		expo_max++;
 
 	mSign = sign;
-	mNumber = s;
+	mNumber.swap( s );
 	mExpo = expo_max;
 
 	return *this;
@@ -1182,19 +1281,11 @@ inline float_precision& float_precision::operator+=( const float_precision& a )
 ///
 /// Description:
 ///   The essential -= operator
-///   n = n - a is the same as n = n + (-a). so change sign and use the += operator instead
+///   n = n - a is the same as n = n + (-a). so add a with the sign changed
 //
 inline float_precision& float_precision::operator-=( const float_precision& a )
 	{
-	float_precision b;
-
-	b.precision( a.precision() );
-	b.mode( a.mode() );
-	b = a;
-	b.change_sign();
-	*this += b;
-
-	return *this;
+	return add_signed( a, -a.mSign );
 	}
 
 ///	@author Henrik Vestermark (hve@hvks.com)
@@ -1207,34 +1298,42 @@ inline float_precision& float_precision::operator-=( const float_precision& a )
 ///
 /// Description:
 ///   The essential *= operator
-///   1) Multiply mantissa
+///   1) Multiply mantissa. Below precision_ctrl.mul_limb_threshold() digits only the leading digits needed for the rounding
 ///   2) Add exponent
 ///   3) Normalize
 ///   4) Rounding to precision
 //
 inline float_precision& float_precision::operator*=( const float_precision& a )
 	{
-	int expo_res;
+	int expo_res, drop = 0;
 	int sign, sign1, sign2;
-	std::string s, s1, s2;
+	std::string s, *s1, *s2;
 
 	// extract sign and unsigned portion of number
 	sign1 = a.mSign;
-	s1 = a.mNumber.substr();
+	s1 = (std::string *)&a.mNumber;	// The mantissas are only read so no copies are needed
 	sign2 = mSign;
-	s2 = mNumber.substr();
+	s2 = &mNumber;
 
 	sign = sign1 * sign2;
 	// Check for multiplication of 1 digit and use umul_short().
-	if(s1.length()==1 )
-		s = _float_precision_umul_short( &s2, FDIGIT(s1[0]));
+	if(s1->length()==1 )
+		s = _float_precision_umul_short( s2, FDIGIT((*s1)[0]));
 	else
-		if( s2.length()==1)
-			s=_float_precision_umul_short( &s1, FDIGIT(s2[0]));
+		if( s2->length()==1)
+			s=_float_precision_umul_short( s1, FDIGIT((*s2)[0]));
 		else
-			s = _float_precision_umul_fourier( &s1, &s2 );
+			if( F_RADIX == BASE_10 && s1->length() + s2->length() <= 19 )  // Small value fast path. The product fit in a 64bit integer
+				s = _float_precision_umul64( s1, s2 );
+			else
+#ifdef _INT_PRECISION_LIMB_KERNELS
+			if( std::min( s1->length(), s2->length() ) < precision_ctrl.mul_limb_threshold() )
+				s = _float_precision_umul_high( s1, s2, mPrec, &drop );	// Only the leading digits that survive the rounding
+			else
+#endif
+			s = _float_precision_umul_fourier( s1, s2 );
 	expo_res = mExpo + a.mExpo;
-	if( s.length() -1 > s1.length() + s2.length() -2 ) // A carry
+	if( s.length() + drop -1 > s1->length() + s2->length() -2 ) // A carry
 		expo_res++;
 	expo_res += _float_precision_normalize( &s );            // Normalize the number
 	if( _float_precision_rounding( &s, sign, mPrec, mRmode ) != 0 )  // Round back left hand side precision
@@ -1247,7 +1346,7 @@ inline float_precision& float_precision::operator*=( const float_precision& a )
 
 	mSign = sign;
 	mExpo = expo_res;
-	mNumber = s;
+	mNumber.swap( s );
 
 	return *this;
 	}
@@ -1273,6 +1372,15 @@ inline float_precision& float_precision::operator/=( const float_precision& a )
 	if( mNumber.length() == 1 && FDIGIT( mNumber[0] ) == 0 ) // If divisor is zero the result is zero
 		return *this;
 
+	// Small value fast path. Long division of the short mantissas with native 64bit arithmetic
+	if( _float_precision_div64( &mNumber, &mExpo, &mNumber, mExpo, &a.mNumber, a.mExpo, mPrec ) )
+		{
+		mSign *= a.mSign;
+		if( _float_precision_rounding( &mNumber, mSign, mPrec, mRmode ) != 0 )  // Round to left hand side precision
+			mExpo++;
+		return *this;
+		}
+
 	float_precision c;
 
 	c.precision( a.precision() );
@@ -1313,7 +1421,8 @@ inline float_precision operator+( float_precision& lhs, float_precision& rhs)
 	if (lhs.precision() > c.precision())
 		c.precision(lhs.precision());
 
-	return c += lhs;
+	c += lhs;
+	return c;
 	}
 */
 
@@ -1337,7 +1446,8 @@ template <class _Ty> inline float_precision operator+( float_precision& lhs, con
 	if( lhs.precision() > c.precision() )
 		c.precision( lhs.precision() );
 
-	return c += lhs;
+	c += lhs;
+	return c;
 	}
 
 
@@ -1359,7 +1469,8 @@ template <class _Ty> inline float_precision operator+( const _Ty& lhs, const flo
 	if( rhs.precision() > c.precision() )
 		c.precision( rhs.precision() );
 
-	return c += rhs;
+	c += rhs;
+	return c;
 	}
 
 ///   @author Henrik Vestermark (hve@hvks.com)
@@ -1380,7 +1491,29 @@ inline float_precision operator+( int_precision& lhs, float_precision& rhs )
 	if( rhs.precision() > c.precision() )
 		c.precision( rhs.precision() );
 
-	return c += rhs;
+	c += rhs;
+	return c;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 			operator+
+///	@return 	float_precision	-	return addition of lhs + rhs
+///	@param   "lhs"	-	First operand. A temporary
+///	@param   "rhs"	-	Second operand
+///
+/// Description:
+///   Add operator for a temporary float_precision + float_precision
+///   The result is calculated in the mantissa of lhs instead of a copy of it
+///   and has the highest precision of lhs and rhs
+///
+inline float_precision operator+( float_precision&& lhs, const float_precision& rhs )
+	{
+	if( lhs.precision() < rhs.precision() )
+		lhs.precision( rhs.precision() );
+
+	lhs += rhs;
+	return std::move( lhs );
 	}
 
 
@@ -1402,7 +1535,8 @@ inline float_precision operator+( float_precision& lhs, int_precision& rhs )
 	if (lhs.precision() > c.precision())
 		c.precision(lhs.precision());
 
-	return c += lhs;
+	c += lhs;
+	return c;
 	}
 
 ///	@author Henrik Vestermark (hve@hvks.com)
@@ -1442,7 +1576,8 @@ template <class _Ty> inline float_precision operator-( float_precision& lhs, con
 	if (d.precision() < c.precision())
 		d.precision(c.precision());
 
-	return d -= c;
+	d -= c;
+	return d;
 	}
 
 ///	@author Henrik Vestermark (hve@hvks.com)
@@ -1465,7 +1600,8 @@ template <class _Ty> inline float_precision operator-( const _Ty& lhs, const flo
 	if (d.precision() < c.precision())
 		d.precision(c.precision());
 
-	return d -= c;
+	d -= c;
+	return d;
 	}
 
 ///   @author Henrik Vestermark (hve@hvks.com)
@@ -1486,7 +1622,29 @@ inline float_precision operator-(int_precision& lhs, float_precision& rhs)
 	if (rhs.precision() > c.precision())
 		c.precision(rhs.precision());
 
-	return c -= rhs;
+	c -= rhs;
+	return c;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 			operator-
+///	@return 	float_precision	-	return subtraction of lhs - rhs
+///	@param   "lhs"	-	First operand. A temporary
+///	@param   "rhs"	-	Second operand
+///
+/// Description:
+///   Sub operator for a temporary float_precision - float_precision
+///   The result is calculated in the mantissa of lhs instead of a copy of it
+///   and has the highest precision of lhs and rhs
+///
+inline float_precision operator-( float_precision&& lhs, const float_precision& rhs )
+	{
+	if( lhs.precision() < rhs.precision() )
+		lhs.precision( rhs.precision() );
+
+	lhs -= rhs;
+	return std::move( lhs );
 	}
 
 
@@ -1563,7 +1721,8 @@ template <class _Ty> inline float_precision operator*(float_precision& lhs, cons
 	if (lhs.precision() > c.precision())
 		c.precision(lhs.precision());
 
-	return c *= lhs;
+	c *= lhs;
+	return c;
 	}
 
 ///	@author Henrik Vestermark (hve@hvks.com)
@@ -1586,7 +1745,8 @@ template <class _Ty> inline float_precision operator*( const _Ty&lhs, const floa
 	if (rhs.precision() > c.precision())
 		c.precision(rhs.precision());
 
-	return c *= rhs;
+	c *= rhs;
+	return c;
 	}
 
 ///   @author Henrik Vestermark (hve@hvks.com)
@@ -1607,7 +1767,29 @@ inline float_precision operator*(int_precision& lhs, float_precision& rhs)
 	if (rhs.precision() > c.precision())
 		c.precision(rhs.precision());
 
-	return c *= rhs;
+	c *= rhs;
+	return c;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 			operator*
+///	@return 	float_precision	-	return multiplication of lhs * rhs
+///	@param   "lhs"	-	First operand. A temporary
+///	@param   "rhs"	-	Second operand
+///
+/// Description:
+///   Mul operator for a temporary float_precision * float_precision
+///   The result is calculated in the mantissa of lhs instead of a copy of it
+///   and has the highest precision of lhs and rhs
+///
+inline float_precision operator*( float_precision&& lhs, const float_precision& rhs )
+	{
+	if( lhs.precision() < rhs.precision() )
+		lhs.precision( rhs.precision() );
+
+	lhs *= rhs;
+	return std::move( lhs );
 	}
 
 
@@ -1663,7 +1845,8 @@ template <class _Ty> inline float_precision operator/(float_precision& lhs, cons
 	if (d.precision() < c.precision())
 		d.precision(c.precision());
 
-	return d /= c;
+	d /= c;
+	return d;
 	}
 
 ///	@author Henrik Vestermark (hve@hvks.com)
@@ -1686,7 +1869,8 @@ template <class _Ty> inline float_precision operator/(const _Ty& lhs, const floa
 	if (d.precision() < c.precision())
 		d.precision(c.precision());
 
-	return d /= c;
+	d /= c;
+	return d;
 	}
 
 ///   @author Henrik Vestermark (hve@hvks.com)
@@ -1707,7 +1891,29 @@ inline float_precision operator/(int_precision& lhs, float_precision& rhs)
 	if (rhs.precision() > c.precision())
 		c.precision(rhs.precision());
 
-	return c /= rhs;
+	c /= rhs;
+	return c;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 			operator/
+///	@return 	float_precision	-	return division of lhs / rhs
+///	@param   "lhs"	-	First operand. A temporary
+///	@param   "rhs"	-	Second operand
+///
+/// Description:
+///   Div operator for a temporary float_precision / float_precision
+///   The result is calculated in the mantissa of lhs instead of a copy of it
+///   and has the highest precision of lhs and rhs
+///
+inline float_precision operator/( float_precision&& lhs, const float_precision& rhs )
+	{
+	if( lhs.precision() < rhs.precision() )
+		lhs.precision( rhs.precision() );
+
+	lhs /= rhs;
+	return std::move( lhs );
 	}
 
 
@@ -1995,6 +2201,46 @@ inline std::string float_precision::toFixed(int fix = 0)
 	return ss;								// Return formatted representation of number
 	}
 
+// .leading_digits()
+//
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	leading_digits(n,expo)  float precision leading digits method
+///	@return 			The first n significant BASE_10 digits rounded with the rounding mode of the number. Trailing zeros are removed
+///	@param   "n"	-	Number of significant digits. At least 1
+///	@param   "expo"	-	Return the BASE_10 exponent of the first digit
+///
+///	@todo
+///
+/// Description:
+///   With F_RADIX BASE_10 only the first n+1 digits of the mantissa are needed to round to n digits since the mantissa
+///   never has trailing zeros, so the cost is O(n) instead of the O(size) of toString(). Other radixes use toString()
+//
+inline std::string float_precision::leading_digits( unsigned int n, int *expo ) const
+	{
+	std::string ss;
+	unsigned int inx;
+
+	if( n < 1 ) n = 1;
+	if( F_RADIX == BASE_10 )
+		{
+		ss = mNumber.substr( 0, (size_t)n + 1 );
+		*expo = mExpo;
+		}
+	else
+		{
+		ss = this->toString();					// Now we have it in exponetial form and in Base 10 with leading sign
+		if( mSign < 0 )
+			ss.erase( 0, 1 );					// Erase sign
+		inx = ss.find( "E" );					// Find start of Exponent
+		*expo = atoi( ss.substr( inx + 1 ).c_str() );  // Get exponent value
+		ss.erase( inx, std::string::npos );		// Erase exponent value from string
+		ss.erase( 1, 1 );						// Erase .
+		}
+	*expo += _float_precision_rounding( &ss, mSign, n, mRmode );
+	return ss;
+	}
+
 // .toPrecision()
 //
 ///	@author Henrik Vestermark (hve@hvks.com)
@@ -2008,25 +2254,17 @@ inline std::string float_precision::toFixed(int fix = 0)
 /// Description:
 ///   return the string value value of the precision of the float_precision number
 ///	  same functionality as the javascript .toPrecision() method	
+///   Only the leading fix digits are converted
 //
 inline std::string float_precision::toPrecision(int fix = 1) const
 	{
 	std::string ss;
-	char sign;
 	unsigned int inx, shf;
 	int expo;
 
 	if (fix <= 1 ) fix = 1;
-	sign = this->mSign;
-	ss = this->toString();					// Now we have it in exponetial form and in Base 10 with leading sign
-	if(sign<0)
-		ss.erase(0, 1);						// Erase sign
-	inx = ss.find("E");						// Find start of Exponent
-	expo = atoi(ss.substr(inx + 1).c_str());  // Get exponent value
-	ss.erase(inx, std::string::npos);		// Erase exponent value from string
-	ss.erase(1, 1);							// Erase .
+	ss = this->leading_digits( fix, &expo );	// The rounded leading digits and the exponent
 	inx = 1;								// Where dot should be inserted			
-	_float_precision_rounding(&ss, sign == '-' ? -1 : 1, fix, this->mRmode);  // Round to fix
 	if (expo >= 0)
 		{
 		if ((unsigned)fix> ss.length() ) ss.insert(ss.length(), fix - ss.length(), '0');  // Trailing with zeros, so we have fix decimals
@@ -2047,7 +2285,7 @@ inline std::string float_precision::toPrecision(int fix = 1) const
 			}
 		}
 	ss = ss.substr(0, inx) + ((unsigned)fix > inx ? "." : "") + ss.substr(inx, fix);
-	if (sign <0) ss.insert(0, 1, '-');		// Add sign if negative
+	if (mSign <0) ss.insert(0, 1, '-');		// Add sign if negative
 	if (expo != 0) { ss += "E"; ss+=(expo < 0 ? "-" : ""); ss += itostring(abs(expo), BASE_10); }
 	return ss;
 	}
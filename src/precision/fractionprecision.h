@@ -34,44 +34,81 @@
  * Version	Author/Date		Description of changes
  * -------  -----------		----------------------
  * 01.01	HVE/15-JUL-2019	Initial release
+ * 01.02	agent/16-OCT-2026	Lazy normalization. The fraction is only reduced when it has grown past a size budget or when the numerator
+ *							or denominator is read, e.g. by a comparison or output. *= and /= cross cancel the operands instead of
+ *							reducing the product. Assignment no longer normalize
+ * 01.03	agent/16-OCT-2026	reduce() is no longer const since n and d are mutable. It normalize first and update the normalized flag and size
  *
  * End of Change Record
  * --------------------------------------------------------------------------
 */
 
 /* define version string */
-static char _VC_[] = "@(#)fractionprecision.h 01.01 -- Copyright (C) Henrik Vestermark";
+static char _VC_[] = "@(#)fractionprecision.h 01.03 -- Copyright (C) Henrik Vestermark";
 
 #include <iostream>
 
+// Minimum number of digits in the numerator and denominator before an unreduced fraction is normalized
+static const size_t FRACTION_LAZY_DIGITS = 100;
+
+// Size used by the lazy normalization. 0 means unknown and built in types are always normalized to avoid overflow
+template<class _Ty> inline size_t _fraction_size( const _Ty& ) { return 0; }
+inline size_t _fraction_size( const int_precision& a ) { return a.size(); }
+
 // Complex Precision template class for fraction arithmetic
 // Notice construction,assignments always guarantees that normalized fraction sign is always in the numerator. As a consequence the sign method just return the sign of the numerator
+// The fraction is normalized lazily. The arithmetic operators leave common factors in the numerator and denominator until the size
+// has doubled since the last normalization (and is at least FRACTION_LAZY_DIGITS). numerator() and denominator() and therefore
+// comparison and output always see the normalized fraction. n and d are mutable so the normalization can be cached by const methods
 template<class _Ty> class fraction_precision {
-   _Ty n, d;
+   mutable _Ty n, d;
+   mutable bool mNormalized;		// true if n and d has no common factors
+   mutable size_t mSize;			// Size of n and d after the last normalization
+
+   // Normalize if not already done
+   void canonical() const	{ if( !mNormalized ) { _Ty z = gcd(n, d); if (z == (_Ty)0) throw divide_by_zero(); if( !( z == (_Ty)1 ) ) { n /= z; d /= z; } mNormalized = true; mSize = _fraction_size(n) + _fraction_size(d); } fixsign(); }
+   // Normalize if the fraction has grown past the budget
+   void lazy() const		{ size_t sz = _fraction_size(n) + _fraction_size(d); if( !mNormalized && ( sz == 0 || ( sz > 2 * mSize && sz > FRACTION_LAZY_DIGITS ) ) ) canonical(); else fixsign(); }
+   // Keep the sign in the numerator
+   void fixsign() const		{ if (!(d >= 0)) { n *= (_Ty)-1; d *= (_Ty)-1; } }
+   // Multiply with xn/xd. The gcd of n,xd and xn,d are removed first. If both fractions are normalized so is the product.
+   // The two gcd's are on the operands which is cheaper than a gcd of the product
+   fraction_precision<_Ty>& cross_multiply( const _Ty& xn, const _Ty& xd, bool normalized )
+	  {
+	  _Ty a(xn), b(xd), g1 = gcd(n, b), g2 = gcd(a, d);
+	  if (!(g1 == (_Ty)0 || g1 == (_Ty)1)) { n /= g1; b /= g1; }
+	  if (!(g2 == (_Ty)0 || g2 == (_Ty)1)) { a /= g2; d /= g2; }
+	  n *= a; d *= b;
+	  mNormalized = mNormalized && normalized;
+	  lazy();
+	  return *this;
+	  }
+
    public:
       typedef _Ty value_type;
 
       // constructor
-	  fraction_precision(const _Ty& a = (_Ty)0, const _Ty& b = (_Ty)1) : n(a), d(b) { normalize(); }		// fraction constructions
-	  fraction_precision(const _Ty& whole, const _Ty& a, const _Ty& b) : n(a + w*b), d(b) { normalize(); }  // mixed number constructions
+	  fraction_precision(const _Ty& a = (_Ty)0, const _Ty& b = (_Ty)1) : n(a), d(b), mNormalized(false), mSize(0) { normalize(); }		// fraction constructions
+	  fraction_precision(const _Ty& whole, const _Ty& a, const _Ty& b) : n(a + whole*b), d(b), mNormalized(false), mSize(0) { normalize(); }  // mixed number constructions
 
       // constructor for any other type to _Ty
-      template<class _X> fraction_precision( const fraction_precision<_X>& a ) : n((_Ty)a.numerator()), d((_Ty)a.denominator()) {}
+      template<class _X> fraction_precision( const fraction_precision<_X>& a ) : n((_Ty)a.numerator()), d((_Ty)a.denominator()), mNormalized(false), mSize(0) { normalize(); }
       
       // Coordinate functions
-      _Ty numerator() const { return n; }						// return numerator
-      _Ty denominator() const { return d; }						// return denominator
-      _Ty numerator( const _Ty& a )   { return ( n = a ); }		// Set mumerator
-	  _Ty numerator( const fraction_precision<_Ty>& a )   { return ( n = a.numerator() ); }  // Set numerator from another fraction
-      _Ty denominator( const _Ty& b )   { return ( d = b ); }	// Set denominator
-	  _Ty denominator( const fraction_precision<_Ty>& b )   { return ( d = b.denominator() ); } // Set denominator from another fraction
+      _Ty numerator() const { canonical(); return n; }			// return numerator
+      _Ty denominator() const { canonical(); return d; }		// return denominator
+      _Ty numerator( const _Ty& a )   { mNormalized = false; return ( n = a ); }		// Set mumerator
+	  _Ty numerator( const fraction_precision<_Ty>& a )   { mNormalized = false; return ( n = a.numerator() ); }  // Set numerator from another fraction
+      _Ty denominator( const _Ty& b )   { mNormalized = false; return ( d = b ); }	// Set denominator
+	  _Ty denominator( const fraction_precision<_Ty>& b )   { mNormalized = false; return ( d = b.denominator() ); } // Set denominator from another fraction
 	  _Ty whole() const { return n / d; }						// return the whole number 
-	  _Ty reduce() const { _Ty w = n / d; n %= d; return w; }	// Reduce the fraction by removing and returning the whole number from the fraction
+	  _Ty reduce() { canonical(); _Ty w = n / d; n %= d; mNormalized = true; mSize = _fraction_size(n) + _fraction_size(d); return w; }	// Reduce the fraction by removing and returning the whole number from the fraction. gcd(n%d,d)==gcd(n,d) so it stays normalized
 
 	  // Methods
 	  fraction_precision<_Ty>& abs(const fraction_precision<_Ty>& a) { n = abs(a.numerator()); d = abs(a.denominator()); return *this; }
-	  fraction_precision<_Ty>& normalize()	{ _Ty z = gcd(n, d); if (z == (_Ty)0) throw divide_by_zero(); n/= z; d /= z; if (!(d >= 0)) { n *= (_Ty)-1; d *= (_Ty)-1; } return *this; }
-	  fraction_precision<_Ty>& inverse()	{ _Ty z; z = n; n = d; d = z; if (!(d >= 0)) { n *= (_Ty)-1; d *= (_Ty)-1; } return *this; }
+	  fraction_precision<_Ty>& normalize()	{ canonical(); return *this; }
+	  const fraction_precision<_Ty>& normalize() const	{ canonical(); return *this; }
+	  fraction_precision<_Ty>& inverse()	{ _Ty z; z = n; n = d; d = z; fixsign(); return *this; }
 	  // Conversion methods. Safer and less ambiguous than overloading implicit/explicit conversion operators
 	 // std::string fraction_precision<int_precision>& toString() { return n.toString() + "/" + d.toString(); }
 																			
@@ -90,11 +127,11 @@ template<class _Ty> class fraction_precision {
 	  operator int_precision() const	{ return (int_precision)n / (int_precision)d; }
 
       // Essential operators
-	  fraction_precision<_Ty>& operator= (const fraction_precision<_Ty>& x)		{ n = x.numerator(); d = x.denominator(); normalize();  return *this; }
-	  fraction_precision<_Ty>& operator+=( const fraction_precision<_Ty>& x)	{ n *= x.denominator(); n += d*x.numerator(); d *= x.denominator(); return *this; }
-      fraction_precision<_Ty>& operator-=( const fraction_precision<_Ty>& x )   { n *= x.denominator(); n -= d*x.numerator(); d *= x.denominator(); return *this; }
-      fraction_precision<_Ty>& operator*=( const fraction_precision<_Ty>& x )   { n *= x.numerator(); d *= x.denominator(); return *this; }
-	  fraction_precision<_Ty>& operator/=( const fraction_precision<_Ty>& x )	{ n *= x.denominator(); d *= x.numerator(); return *this; } 
+	  fraction_precision<_Ty>& operator= (const fraction_precision<_Ty>& x)		{ n = x.n; d = x.d; mNormalized = x.mNormalized; mSize = x.mSize; return *this; }
+	  fraction_precision<_Ty>& operator+=( const fraction_precision<_Ty>& x)	{ _Ty xn(x.n); n *= x.d; n += d*xn; d *= x.d; mNormalized = false; lazy(); return *this; }
+      fraction_precision<_Ty>& operator-=( const fraction_precision<_Ty>& x )   { _Ty xn(x.n); n *= x.d; n -= d*xn; d *= x.d; mNormalized = false; lazy(); return *this; }
+      fraction_precision<_Ty>& operator*=( const fraction_precision<_Ty>& x )   { return cross_multiply( x.n, x.d, x.mNormalized ); }
+	  fraction_precision<_Ty>& operator/=( const fraction_precision<_Ty>& x )	{ return cross_multiply( x.d, x.n, x.mNormalized ); }
 		 
 	  class divide_by_zero {};
    };
@@ -222,10 +259,8 @@ template<class _Ty> fraction_precision<_Ty> operator--(fraction_precision<_Ty>&
 
 // lhs == rhs
 template<class _Ty> bool operator==( const fraction_precision<_Ty>& lhs, const fraction_precision<_Ty>& rhs )
-	{fraction_precision<_Ty> a, b;
-	a = lhs; 
-	b = rhs; 
-	return a.numerator() == b.numerator() && a.denominator() == b.denominator();
+	{
+	return lhs.numerator() == rhs.numerator() && lhs.denominator() == rhs.denominator();
 	}
 
 // lhs != rhs
@@ -237,26 +272,16 @@ template<class _Ty> bool operator!=( const fraction_precision<_Ty>& lhs, const f
 // lhs >= rhs
 // a/b>=c/d => a*d>=c*b
 template<class _Ty> bool operator>=(const fraction_precision<_Ty>& lhs, const fraction_precision<_Ty>& rhs)
-{
-	bool bb;
-	fraction_precision<_Ty> a, b;
-	a = lhs;
-	b = rhs; 
-	bb= a.numerator()*b.denominator()>=b.numerator()*a.denominator();
-	return bb;
+	{
+	return lhs.numerator()*rhs.denominator() >= rhs.numerator()*lhs.denominator();
 	}
 
 // lhs > rhs 
 // a/b>c/d => a*d>c*b
 template<class _Ty> bool operator>(const fraction_precision<_Ty>& lhs, const fraction_precision<_Ty>& rhs)
-{
-	bool bb;
-	fraction_precision<_Ty> a, b;
-	a = lhs;  
-	b = rhs;  
-	bb = a.numerator()*b.denominator() > b.numerator()*a.denominator();
-	return bb;
-}
+	{
+	return lhs.numerator()*rhs.denominator() > rhs.numerator()*lhs.denominator();
+	}
 
 // lhs <= rhs
 template<class _Ty> bool operator<=(const fraction_precision<_Ty>& lhs, const fraction_precision<_Ty>& rhs)
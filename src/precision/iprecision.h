@@ -90,20 +90,54 @@
  * 02.00	HVE/SEP-11-2019 New internal class layout with version switch to 2.0
  * 02.01	HVE/17-Sep-2019	Further optmization of the code. _int_precision_atoi() has been added and additional parameter that returns the sign of the string
  * 02.02	HVE/18-SEP-2019 _int_precision_uadd() has been speeded up using fewer std::string copies of variables.
+ * 02.03	agent/16-OCT-2026	Added the binary limb kernels (_INT_PRECISION_LIMB_KERNELS). _int_precision_usub() and _int_precision_umul() now work
+ *							on 32bit limbs holding ILIMB_DIGITS digits each and *= use _int_precision_umul() below IMUL_LIMB_THRESHOLD digits
+ * 02.04	agent/16-OCT-2026	Added _int_precision_umul_ntt() an exact three prime number theoretic transform multiplication. *= use it
+ *							from IMUL_NTT_THRESHOLD digits
+ * 02.05	agent/16-OCT-2026	The limb multiplication now use Toom-Cook 3 way from ITOOM3_THRESHOLD limbs. Retuned IMUL_LIMB_THRESHOLD and IMUL_NTT_THRESHOLD
+ * 02.06	agent/16-OCT-2026	_int_precision_karatsuba_umul() rewritten to work on limbs with a single scratch arena. The limb multiplication use
+ *							Karatsuba from IKARATSUBA_THRESHOLD limbs
+ * 02.07	agent/16-OCT-2026	The multiplication thresholds moved to precisiontune.h and are now runtime values in precision_ctrl
+ * 02.08	agent/16-OCT-2026	Added the _INT_PRECISION_SIMD_FFT switch for the SIMD fourier butterflies
+ * 02.09	agent/16-OCT-2026	/= and %= use the limb kernel division instead of _int_precision_fastdiv() and _int_precision_fastrem().
+ *							Added precision_ctrl::div_newton_threshold()
+ * 02.10	agent/16-OCT-2026	gcd() use Lehmer steps and the half gcd on limbs. Added precision_ctrl::gcd_hgcd_threshold()
+ * 02.11	agent/16-OCT-2026	Added the int_precision_modulus class. Fixed the declaration of ipow_modulo() that was named ipow_modular()
+ *							The default constructor did not initialize the sign
+ * 02.12	agent/16-OCT-2026	Added the method .leading_digits()
+ * 02.13	agent/16-OCT-2026	Added move constructor, move assignment and operator+,-,*,/ for a temporary left hand side that reuse its digits.
+ *							The binary operators no longer copy the result of the compound assignment and -= no longer copy the operand
+ * 02.14	agent/16-OCT-2026	+= use native 64bit arithmetic when both operands have at most 18 digits
+ * 02.15	agent/16-OCT-2026	Added the binary splitting series threshold to precision_ctrl
+ * 02.16	agent/16-OCT-2026	Added the arithmetic geometric mean and exp Newton thresholds to precision_ctrl
+ * 02.17	agent/16-OCT-2026	.leading_digits() clamp the number of digits to at least 1 before it take the leading digits
  *
  * End of Change Record
  * --------------------------------------------------------------------------
 */
 
 /* define version string */
-static char _VI_[] = "@(#)iprecision.h 02.02 -- Copyright (C) Henrik Vestermark";
+static char _VI_[] = "@(#)iprecision.h 02.17 -- Copyright (C) Henrik Vestermark";
+
+// If _INT_PRECISION_LIMB_KERNELS is defined the core subtract, multiply and short functions packs the digits into 32bit binary limbs
+// and perform the arithmetic a whole limb at a time. The number is still stored as a RADIX string and conversion only happens at the kernel boundary
+#define _INT_PRECISION_LIMB_KERNELS
 
 // If _INT_PRECESION_FAST_DIV_REM is defined it will use a magnitude faster div and rem integer operation.
+// The limb kernel division is faster and exact so it is only used without _INT_PRECISION_LIMB_KERNELS
+#ifndef _INT_PRECISION_LIMB_KERNELS
 #define _INT_PRECISSION_FAST_DIV_REM
+#endif
+
+// If _INT_PRECISION_SIMD_FFT is defined the butterflies of the fourier transform use SSE2/AVX2 on x86 and NEON on AArch64.
+// AVX2 is selected at runtime if the cpu support it. Other targets always use the portable version
+#define _INT_PRECISION_SIMD_FFT
 
 #include <limits.h>
 #include <stdint.h>
 #include <string>
+#include <vector>
+#include <utility>   // std::move() for the move constructor and the operators on temporaries
 #include <complex>   // Need <complex> to support FFT functions for fast multiplications
 
 // For ANSI please remove comments from the next 3 line
@@ -116,6 +150,7 @@ using std::atoi; using std::strtoul;
 
 #include <stdlib.h>
 #include <string.h>
+#include "precisiontune.h"
 
 // RADIX can either be 2, 8, 10, 16 or 256
 static const int BASE_2	  = 2;
@@ -137,26 +172,102 @@ static const int BASE_256 = 256;
 ///   This keep track of the internal Base for storing int_precision and Float_precision numbers.
 ///   Default int_precision radix is BASE_10
 ///   Default float_precision radix is BASE_10
+///   It also keep the crossover thresholds between the multiplication and division algorithms
+///   and the precisions from where the float_precision elementary functions use binary splitting series
+///   and where log() use the arithmetic geometric mean and exp() Newton iterations on log().
+///   The defaults comes from precisiontune.h and can be replaced by the values measured by the tune program
 //
 class precision_ctrl {
    int mIRadix;			// Internal base of int_precision
    int mFRadix;			// Internal base of float_precision
+   size_t mKaratsuba;	// Minimum number of limbs before the limb multiplication use Karatsuba
+   size_t mToom3;		// Minimum number of limbs before the limb multiplication use Toom-Cook 3 way
+   size_t mMulLimb;		// Below this number of digits in the smallest operand *= use the limb multiplication
+   size_t mMulNtt;		// From this number of digits in the smallest operand *= use the number theoretic transform instead of FFT
+   size_t mDivNewton;	// Minimum number of limbs in the divisor and the quotient before division use Newton reciprocal and Barrett reduction
+   size_t mGcdHgcd;		// Minimum number of limbs before gcd() use the half gcd
+   size_t mSeries;		// From this precision exp(), sin(), cos() and atan() use binary splitting series
+   size_t mAgm;			// From this precision log() use the arithmetic geometric mean instead of the Taylor series
+   size_t mExpNewton;	// From this precision exp() use Newton iterations on log()
 
    public:
       // Constructor
-      precision_ctrl( int ir=BASE_10, int fr=BASE_10): mIRadix(ir), mFRadix(fr) {}
+      precision_ctrl( int ir=BASE_10, int fr=BASE_10): mIRadix(ir), mFRadix(fr), mKaratsuba(IKARATSUBA_THRESHOLD), mToom3(ITOOM3_THRESHOLD),
+														mMulLimb(IMUL_LIMB_THRESHOLD), mMulNtt(IMUL_NTT_THRESHOLD), mDivNewton(IDIV_NEWTON_THRESHOLD),
+														mGcdHgcd(IGCD_HGCD_THRESHOLD), mSeries(FSERIES_THRESHOLD), mAgm(FAGM_THRESHOLD),
+														mExpNewton(FEXP_NEWTON_THRESHOLD) {}
 
       // Coordinate functions
       inline int I_RADIX() const		{ return mIRadix; }
       inline int I_RADIX( int ir )		{ return( mIRadix = ir ); }
 	  inline int F_RADIX() const		{ return mFRadix; }
 	  inline int F_RADIX( int fr )		{ return( mFRadix = fr ); }
+	  inline size_t karatsuba_threshold() const		{ return mKaratsuba; }
+	  inline size_t karatsuba_threshold( size_t t )	{ return( mKaratsuba = t < 4 ? 4 : t ); }		// Karatsuba need at least 4 limbs to make progress
+	  inline size_t toom3_threshold() const			{ return mToom3; }
+	  inline size_t toom3_threshold( size_t t )		{ return( mToom3 = t < 8 ? 8 : t ); }			// Toom-Cook 3 way need at least 8 limbs to make progress
+	  inline size_t mul_limb_threshold() const		{ return mMulLimb; }
+	  inline size_t mul_limb_threshold( size_t t )	{ return( mMulLimb = t ); }
+	  inline size_t mul_ntt_threshold() const		{ return mMulNtt; }
+	  inline size_t mul_ntt_threshold( size_t t )	{ return( mMulNtt = t ); }
+	  inline size_t div_newton_threshold() const		{ return mDivNewton; }
+	  inline size_t div_newton_threshold( size_t t )	{ return( mDivNewton = t < 8 ? 8 : t ); }		// The Newton reciprocal need at least 8 limbs to make progress
+	  inline size_t gcd_hgcd_threshold() const		{ return mGcdHgcd; }
+	  inline size_t gcd_hgcd_threshold( size_t t )	{ return( mGcdHgcd = t < 8 ? 8 : t ); }			// The half gcd need at least 8 limbs to make progress
+	  inline size_t series_threshold() const			{ return mSeries; }
+	  inline size_t series_threshold( size_t t )		{ return( mSeries = t ); }
+	  inline size_t agm_threshold() const			{ return mAgm; }
+	  inline size_t agm_threshold( size_t t )		{ return( mAgm = t ); }
+	  inline size_t exp_newton_threshold() const		{ return mExpNewton; }
+	  inline size_t exp_newton_threshold( size_t t )	{ return( mExpNewton = t ); }
+
+	  // Load or save the thresholds as lines of "name value"
+	  bool load_thresholds( const char * );
+	  bool save_thresholds( const char * ) const;
       };
 
 extern precision_ctrl precision_ctrl;
 
 static const int RADIX = BASE_10;			// Set internal base for the arbitrary precision
 
+// Binary limbs used by the limb kernels. Each limb holds ILIMB_DIGITS digits of the internal RADIX and ILIMB_BASE = RADIX^ILIMB_DIGITS
+typedef uint32_t ilimb_t;
+static const int ILIMB_DIGITS = RADIX == BASE_10 ? 9 : RADIX == BASE_256 ? 4 : RADIX == BASE_16 ? 8 : RADIX == BASE_8 ? 10 : 31;
+static const uint64_t ILIMB_BASE = RADIX == BASE_10 ? 1000000000ULL : RADIX == BASE_2 ? 1ULL << 31 : RADIX == BASE_8 ? 1ULL << 30 : 1ULL << 32;
+static const size_t ILIMB_THRESHOLD = 2 * ILIMB_DIGITS;	// Minimum number of digits before subtract and the short operations use the limb kernels
+
+#ifdef _INT_PRECISION_LIMB_KERNELS
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	struct _int_limb_barrett
+///
+/// Description:
+///   Barrett context for repeated division with the same divisor. The divisor b is stored normalized
+///   as b*f with the top limb at least ILIMB_BASE/2 together with its reciprocal from _int_limb_reciprocal().
+///   Small divisors has no reciprocal and use _int_limb_knuth_divrem() instead
+//
+struct _int_limb_barrett {
+	std::vector<ilimb_t> b;		// Normalized divisor
+	std::vector<ilimb_t> inv;	// ILIMB_BASE^(2n)/b. Empty when long division is used
+	unsigned int f;				// Normalization factor
+	};
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	struct _int_limb_montgomery
+///
+/// Description:
+///   Montgomery context for an odd modulus m with no factor in common with ILIMB_BASE. R=ILIMB_BASE^n with n the number of limbs in m.
+///   Numbers in Montgomery form x*R mod m are stored in n limbs
+//
+struct _int_limb_montgomery {
+	std::vector<ilimb_t> m;		// The modulus
+	std::vector<ilimb_t> one;	// R mod m. 1 in Montgomery form
+	std::vector<ilimb_t> r2;	// R^2 mod m
+	uint64_t minv;				// -m^-1 mod ILIMB_BASE
+	};
+#endif
+
 inline std::string SIGN_STRING( int x )   { return x >=0 ? "+" : "-" ; }
 inline int CHAR_SIGN( char x )            { return x == '-' ? -1 : 1; }
 inline unsigned char IDIGIT( char x )     { return RADIX <= 10 ? (unsigned char)( x - '0') : (unsigned char)x; }
@@ -171,20 +282,24 @@ class int_precision;
 // Arithmetic
 template <class _Ty> inline int_precision operator+( int_precision&, const _Ty& );
 template <class _Ty> inline int_precision operator+( const _Ty&, const int_precision& );
+inline int_precision operator+( int_precision&&, const int_precision& );	// Reuse the digits of a temporary lhs
 inline int_precision operator+( const int_precision& );        // Unary
 inline int_precision operator++( int_precision& );       // Prefix Increment
 inline int_precision operator++( int_precision&, int );  // Postfix Increment
 
 template <class _Ty> inline int_precision operator-( int_precision&, const _Ty&);
 template <class _Ty> inline int_precision operator-( const _Ty&, const int_precision& );
+inline int_precision operator-( int_precision&&, const int_precision& );	// Reuse the digits of a temporary lhs
 inline int_precision operator-( const int_precision& );        // Unary
 inline int_precision operator--( int_precision& );       // Prefix Decrement
 inline int_precision operator--( int_precision&, int );  // Postfix Decrement
 
 template <class _Ty> inline int_precision operator*( int_precision&, const _Ty& );
 template <class _Ty> inline int_precision operator*( const _Ty&, const int_precision& );
+inline int_precision operator*( int_precision&&, const int_precision& );	// Reuse the digits of a temporary lhs
 template <class _Ty> inline int_precision operator/( int_precision&, const _Ty& );
 template <class _Ty> inline int_precision operator/( const _Ty&, const int_precision& );
+inline int_precision operator/( int_precision&&, const int_precision& );	// Reuse the digits of a temporary lhs
 template <class _Ty> inline int_precision operator%( int_precision&, const _Ty& );
 template <class _Ty> inline int_precision operator%( const _Ty&, const int_precision& );
 template <class _Ty> inline int_precision operator<<( int_precision&, const _Ty& );
@@ -211,7 +326,7 @@ template <class _Ty> inline bool operator<( const _Ty&, const int_precision& );
 // Integer Precision functions
 extern int_precision abs(const int_precision&);
 extern int_precision ipow( const int_precision&, const int_precision& );    // a^b
-extern int_precision ipow_modular( const int_precision&, const int_precision&, const int_precision& ); // a^b%c
+extern int_precision ipow_modulo( const int_precision&, const int_precision&, const int_precision& ); // a^b%c
 extern bool iprime( const int_precision& );
 template <class _TY> inline _TY gcd( const _TY lhs, const _TY rhs );
 extern int_precision gcd(const int_precision&, const int_precision&);
@@ -227,6 +342,7 @@ std::string _int_precision_umul( std::string *, std::string *);
 std::string _int_precision_umul_short( std::string *, unsigned int );
 std::string _int_precision_umul64( std::string *, std::string * );
 std::string _int_precision_umul_fourier( std::string *, std::string *);
+std::string _int_precision_umul_ntt( std::string *, std::string *);
 std::string _int_precision_karatsuba_umul(const std::string *, const std::string *);
 std::string _int_precision_schonhage_strassen_linear_umul(const std::string *, const std::string *);
 std::string _int_precision_udiv( std::string *, std::string *);
@@ -273,7 +389,7 @@ class int_precision
 
    public:
       // Constructor
-	  int_precision()  { mNumber = (char)ICHARACTER(0); }
+	  int_precision() : mSign(1) { mNumber = (char)ICHARACTER(0); }
  	  int_precision( char );				// When initialized through a char
       int_precision( unsigned char );		// When initialized through a unsigned char
       int_precision( short );				// When initialized through an short
@@ -287,6 +403,7 @@ class int_precision
 	  int_precision( const int64_t );		// When initialized through a 64 bit int
 	  int_precision( const uint64_t );		// When initialized through a 64 bit unsigned int
   	  int_precision( const int_precision& s ) : mNumber(s.mNumber), mSign(s.mSign) {}  // When initialized through another int_precision
+	  int_precision( int_precision&& s ) : mNumber(std::move(s.mNumber)), mSign(s.mSign) { s.mNumber = (char)ICHARACTER(0); s.mSign = 1; }  // Take over the digits of a temporary and leave it as 0
 
       // Coordinate functions
 	  std::string copy(size_t pos = 0, size_t len = std::string::npos) const {return mNumber.substr(pos,len); }  // Same as the string.substr()
@@ -301,6 +418,7 @@ class int_precision
 
 	  // Conversion methods. Safer and less ambiguous than overloading implicit/explicit conversion operators
       std::string toString() const { return _int_precision_itoa(this); }
+	  std::string leading_digits( unsigned int, int * ) const;			// The leading significant BASE_10 digits and the exponent
 
 	  // Implicit/explicit conversion operators
 	  operator long() const;
@@ -316,6 +434,7 @@ class int_precision
 
       // Essential operators
       int_precision& operator=( const int_precision& );
+      int_precision& operator=( int_precision&& );
       int_precision& operator+=( const int_precision& );
       int_precision& operator-=( const int_precision& );
       int_precision& operator*=( const int_precision& );
@@ -337,6 +456,45 @@ class int_precision
       class divide_by_zero {};
    };
 
+///
+/// @class int_precision_modulus
+/// @author agent (agent@local)
+/// @date  16-Oct-2026
+/// @version 1.0
+/// @brief  Modular arithmetic with a fixed modulus
+///
+/// @todo
+///
+/// The constants for the modulus m are computed once by the constructor so repeated modular multiplications and powers
+/// does not need a full division for each step. With the limb kernels a modulus with no factor in common with the limb base
+/// use Montgomery multiplication and any other modulus Barrett reduction with a precomputed reciprocal.
+/// Results are always the residues 0..|m|-1
+///
+class int_precision_modulus
+	{
+	int_precision mModulus;			// |m|
+#ifdef _INT_PRECISION_LIMB_KERNELS
+	bool mMontgomery;				// Use mMont when true otherwise mBarrett
+	_int_limb_montgomery mMont;
+	_int_limb_barrett mBarrett;
+
+	void to_limbs( std::vector<ilimb_t>&, const int_precision& ) const;
+	int_precision from_limbs( std::vector<ilimb_t>& ) const;
+#endif
+
+   public:
+      // Constructor
+      int_precision_modulus( const int_precision& );
+
+      // Coordinate functions
+      const int_precision& modulus() const	{ return mModulus; }
+
+      // Modular arithmetic
+      int_precision reduce( const int_precision& ) const;											// a mod m
+      int_precision mul( const int_precision&, const int_precision& ) const;						// a*b mod m
+      int_precision pow( const int_precision&, const int_precision& ) const;						// a^b mod m
+	};
+
 
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -629,6 +787,51 @@ inline int_precision::int_precision( uint64_t i)
 	mSign = +1;			// Unsigned is always positive
 	}
 
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 			int_precision::leading_digits
+///	@return 		std::string	-	The first n significant BASE_10 digits rounded to nearest. Trailing zeros are removed
+///	@param "n"		-	Number of significant digits. At least 1
+///	@param "expo"	-	Return the BASE_10 exponent of the first digit. The number is about 0.ddd*10^(expo+1)
+///
+///	@todo
+///
+/// Description:
+///   Only the first n+1 digits are looked at when RADIX is BASE_10 so a display of a few digits cost O(n)
+///   independent of the size of the number. Other radixes are converted with _int_precision_itoa() first
+//
+inline std::string int_precision::leading_digits( unsigned int n, int *expo ) const
+	{
+	std::string ss;
+	size_t i;
+
+	if( n < 1 )
+		n = 1;
+	ss = RADIX == BASE_10 ? mNumber.substr( 0, (size_t)n + 1 ) : _int_precision_itoa( &mNumber );
+	*expo = (int)( RADIX == BASE_10 ? mNumber.length() : ss.length() ) - 1;
+	if( ss.length() > n )
+		{
+		bool up = ss[n] >= '5';
+		ss.erase( n );
+		for( i = n; up && i > 0; --i )
+			if( ss[i-1] == '9' )
+				ss[i-1] = '0';
+			else
+				{
+				++ss[i-1];
+				up = false;
+				}
+		if( up )
+			{// 99..9 rounded up to 100..0
+			ss.insert( (std::string::size_type)0, 1, '1' );
+			++*expo;
+			}
+		}
+	for( i = ss.length(); i > 1 && ss[i-1] == '0'; --i ) ;
+	ss.erase( i );
+	return ss;
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 //
 //
@@ -848,6 +1051,25 @@ inline int_precision& int_precision::operator=( const int_precision& a )
 	return *this;
 	}
 
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	operator= for a temporary
+///	@return 	static int_precision	-	return a=b
+///	@param   "a"	-	Assignment operand
+///
+///	@todo
+///
+/// Description:
+///   Move assign operator
+///   The digits are swapped so a keeps a valid number and its buffer can be reused
+//
+inline int_precision& int_precision::operator=( int_precision&& a )
+	{
+	mNumber.swap( a.mNumber );
+	std::swap( mSign, a.mSign );
+	return *this;
+	}
+
 ///	@author Henrik Vestermark (hve@hvks.com)
 ///	@date  1/19/2005
 ///	@brief 	operator+=
@@ -872,6 +1094,26 @@ inline int_precision& int_precision::operator+=( const int_precision& a )
 	//sign2 = mSign;
 	//s2 = mNumber;
 
+	if( RADIX == BASE_10 && mNumber.length() <= 18 && a.mNumber.length() <= 18 )
+		{// Small value fast path. Both operands and the sum fit in a 64bit integer
+		uint64_t x = _stringtou64( &mNumber, RADIX ), y = _stringtou64( (std::string *)&a.mNumber, RADIX );
+
+		if( a.mSign == mSign )
+			x += y;
+		else
+			if( x >= y )
+				x -= y;
+			else
+				{
+				x = y - x;
+				mSign = a.mSign;
+				}
+		if( x == 0 )
+			mSign = +1;  // -0 is not allowed for the internal representation
+		mNumber = u64to_precision_string( x, RADIX );
+		return *this;
+		}
+
 	if( a.mSign == mSign )
 		mNumber = _int_precision_uadd( (std::string *)&a.mNumber, &mNumber );  // Add and no change of sign
 	else
@@ -943,15 +1185,22 @@ inline int_precision& int_precision::operator+=(const int_precision& a)
 /// Description:
 ///   -= operator
 ///   The essential -= operator
-///   n = n - a is the same as n = n + (-a);
+///   n = n - a is the same as n = -( -n + a );
 //
 inline int_precision& int_precision::operator-=( const int_precision& a )
 	{
-	int_precision b;
+	if( this == &a )
+		{// n - n is 0
+		mSign = 1;
+		mNumber = (char)ICHARACTER( 0 );
+		return *this;
+		}
 
-	b = a;
-	b.change_sign();
-	*this += b;
+	// n - a is calculated as -( -n + a ) to avoid a copy of a
+	mSign = -mSign;
+	*this += a;
+	if( mNumber.length() != 1 || IDIGIT( mNumber[0] ) != 0 )  // Avoid -0 as result
+		mSign = -mSign;
 
 	return *this;
 	}
@@ -990,7 +1239,16 @@ inline int_precision& int_precision::operator*=( const int_precision& a )
 		else  // Check for multiplication of of number that can safely be done using 64bit binary multiplication
 			if (length <= 18 && BASE_10==RADIX ||length<=20 && BASE_8==RADIX || length <=64 && BASE_2==RADIX || length <=8 && BASE_256==RADIX )
 				mNumber = _int_precision_umul64( &mNumber, (std::string *)&a.mNumber);
-			else // Use FFT for multiplication
+			else
+#ifdef _INT_PRECISION_LIMB_KERNELS
+			if( ( mNumber.length() < a.mNumber.length() ? mNumber.length() : a.mNumber.length() ) < precision_ctrl.mul_limb_threshold() )
+				mNumber = _int_precision_umul( &mNumber, (std::string *)&a.mNumber );  // Multiply a whole limb at a time
+			else
+#endif
+			if( ( mNumber.length() < a.mNumber.length() ? mNumber.length() : a.mNumber.length() ) >= precision_ctrl.mul_ntt_threshold() )
+				mNumber = _int_precision_umul_ntt( &mNumber, (std::string *)&a.mNumber );  // Exact number theoretic transform
+			else
+			// Use FFT for multiplication
 				mNumber =_int_precision_umul_fourier( &mNumber, (std::string *)&a.mNumber );
 
 	if (mSign == -1 && mNumber.length() == 1 && IDIGIT(mNumber[0]) == 0)  // Avoid -0 as result +0 is right
@@ -1428,7 +1686,10 @@ inline int_precision& int_precision::operator&=( const int_precision& a )
 ///
 template <class _Ty> inline int_precision operator+( int_precision& lhs, const _Ty& rhs )
 	{
-	return int_precision(lhs) += rhs;
+	int_precision c(lhs);
+
+	c += rhs;
+	return c;
 	}
 
 
@@ -1445,7 +1706,27 @@ template <class _Ty> inline int_precision operator+( int_precision& lhs, const _
 ///
 template <class _Ty> inline int_precision operator+( const _Ty& lhs, const int_precision& rhs )
 	{
-	return int_precision(lhs) += rhs;
+	int_precision c(lhs);
+
+	c += rhs;
+	return c;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 			operator+
+///	@return 	int_precision	-	return addition of lhs + rhs
+///	@param   "lhs"	-	First operand. A temporary
+///	@param   "rhs"	-	Second operand
+///
+/// Description:
+///   Add operator for a temporary int_precision + int_precision
+///   The result is calculated in the digits of lhs instead of a copy of it
+///
+inline int_precision operator+( int_precision&& lhs, const int_precision& rhs )
+	{
+	lhs += rhs;
+	return std::move( lhs );
 	}
 
 
@@ -1518,7 +1799,10 @@ inline int_precision operator++( int_precision& a, int )
 ///
 template <class _Ty> inline int_precision operator-( int_precision& lhs, const _Ty& rhs )
 	{
-	return int_precision(lhs) -= rhs;
+	int_precision c(lhs);
+
+	c -= rhs;
+	return c;
 	}
 
 
@@ -1535,7 +1819,27 @@ template <class _Ty> inline int_precision operator-( int_precision& lhs, const _
 ///
 template <class _Ty> inline int_precision operator-( const _Ty& lhs, const int_precision& rhs )
 	{
-	return int_precision(lhs) -= rhs;
+	int_precision c(lhs);
+
+	c -= rhs;
+	return c;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 			operator-
+///	@return 	int_precision	-	return subtraction of lhs - rhs
+///	@param   "lhs"	-	First operand. A temporary
+///	@param   "rhs"	-	Second operand
+///
+/// Description:
+///   Sub operator for a temporary int_precision - int_precision
+///   The result is calculated in the digits of lhs instead of a copy of it
+///
+inline int_precision operator-( int_precision&& lhs, const int_precision& rhs )
+	{
+	lhs -= rhs;
+	return std::move( lhs );
 	}
 
 
@@ -1611,7 +1915,10 @@ int_precision operator--( int_precision& a, int )
 ///
 template <class _Ty> inline int_precision operator*( int_precision& lhs, const _Ty& rhs )
 	{
-	return int_precision(lhs) *= rhs;
+	int_precision c(lhs);
+
+	c *= rhs;
+	return c;
 	}
 
 
@@ -1629,7 +1936,27 @@ template <class _Ty> inline int_precision operator*( int_precision& lhs, const _
 ///
 template <class _Ty> inline int_precision operator*( const _Ty& lhs, const int_precision& rhs )
 	{
-	return int_precision(lhs) *= rhs;
+	int_precision c(lhs);
+
+	c *= rhs;
+	return c;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 			operator*
+///	@return 	int_precision	-	return multiplication of lhs * rhs
+///	@param   "lhs"	-	First operand. A temporary
+///	@param   "rhs"	-	Second operand
+///
+/// Description:
+///   Mul operator for a temporary int_precision * int_precision
+///   The result is calculated in the digits of lhs instead of a copy of it
+///
+inline int_precision operator*( int_precision&& lhs, const int_precision& rhs )
+	{
+	lhs *= rhs;
+	return std::move( lhs );
 	}
 
 
@@ -1648,7 +1975,10 @@ template <class _Ty> inline int_precision operator*( const _Ty& lhs, const int_p
 ///
 template <class _Ty> inline int_precision operator/( int_precision& lhs, const _Ty& rhs )
 	{
-	return int_precision(lhs) /= rhs;
+	int_precision c(lhs);
+
+	c /= rhs;
+	return c;
 	}
 
 
@@ -1665,7 +1995,27 @@ template <class _Ty> inline int_precision operator/( int_precision& lhs, const _
 ///
 template <class _Ty> inline int_precision operator/( const _Ty& lhs, const int_precision& rhs )
 	{
-	return int_precision(lhs) /= rhs;
+	int_precision c(lhs);
+
+	c /= rhs;
+	return c;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 			operator/
+///	@return 	int_precision	-	return division of lhs / rhs
+///	@param   "lhs"	-	First operand. A temporary
+///	@param   "rhs"	-	Second operand
+///
+/// Description:
+///   Div operator for a temporary int_precision / int_precision
+///   The result is calculated in the digits of lhs instead of a copy of it
+///
+inline int_precision operator/( int_precision&& lhs, const int_precision& rhs )
+	{
+	lhs /= rhs;
+	return std::move( lhs );
 	}
 
 ///	@author Henrik Vestermark (hve@hvks.com)
@@ -1682,7 +2032,10 @@ template <class _Ty> inline int_precision operator/( const _Ty& lhs, const int_p
 ///
 template <class _Ty> inline int_precision operator%( int_precision& lhs, const _Ty& rhs )
 	{
-	return int_precision(lhs) %= rhs;
+	int_precision c(lhs);
+
+	c %= rhs;
+	return c;
 	}
 
 
@@ -1699,7 +2052,10 @@ template <class _Ty> inline int_precision operator%( int_precision& lhs, const _
 ///
 template <class _Ty> inline int_precision operator%( const _Ty& lhs, const int_precision& rhs )
 	{
-	return int_precision(lhs) %= rhs;
+	int_precision c(lhs);
+
+	c %= rhs;
+	return c;
 	}
 
 ///	@author Henrik Vestermark (hve@hvks.com)
@@ -1716,7 +2072,10 @@ template <class _Ty> inline int_precision operator%( const _Ty& lhs, const int_p
 ///
 template <class _Ty> inline int_precision operator<<( int_precision& lhs, const _Ty& rhs )
 	{
-	return int_precision(lhs) <<= rhs;
+	int_precision c(lhs);
+
+	c <<= rhs;
+	return c;
 	}
 
 
@@ -1733,7 +2092,10 @@ template <class _Ty> inline int_precision operator<<( int_precision& lhs, const
 ///
 template <class _Ty> inline int_precision operator<<(  const _Ty& lhs, const int_precision& rhs )
 	{
-	return int_precision(lhs) <<= rhs;
+	int_precision c(lhs);
+
+	c <<= rhs;
+	return c;
 	}
 
 
@@ -1751,7 +2113,10 @@ template <class _Ty> inline int_precision operator<<(  const _Ty& lhs, const int
 ///
 template <class _Ty> inline int_precision operator>>( int_precision& lhs, const _Ty& rhs )
 	{
-	return int_precision(lhs) >>= rhs;
+	int_precision c(lhs);
+
+	c >>= rhs;
+	return c;
 	}
 
 
@@ -1768,7 +2133,10 @@ template <class _Ty> inline int_precision operator>>( int_precision& lhs, const
 ///
 template <class _Ty> inline int_precision operator>>( const _Ty& lhs, const int_precision& rhs )
 	{
-	return int_precision(lhs) >>= rhs;
+	int_precision c(lhs);
+
+	c >>= rhs;
+	return c;
 	}
 
 /*
@@ -1787,7 +2155,10 @@ template <class _Ty> inline int_precision operator>>( const _Ty& lhs, const int_
 ///
 template <class _Ty> inline int_precision operator&( int_precision& lhs, const _Ty& rhs )
    {
-   return int_precision(lhs) &= rhs;
+   int_precision c(lhs);
+
+	c &= rhs;
+	return c;
    }
 
 
@@ -1804,7 +2175,10 @@ template <class _Ty> inline int_precision operator&( int_precision& lhs, const _
 ///
 template <class _Ty> inline int_precision operator&( const _Ty& lhs, const int_precision& rhs )
    {
-   return int_precision(lhs) &= rhs;
+   int_precision c(lhs);
+
+	c &= rhs;
+	return c;
    }
 */
 
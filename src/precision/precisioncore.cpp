@@ -89,13 +89,67 @@
  *							Also Added std::string _int_precision_udiv64(string *src1, string *src2 ) to utilized binary division for performance improvement
  * 02.01	HVE/16-SEP-2019	The initial guess for 1/v a d sqrt has been speed up particular for large floating points numbers
  * 02.02	HVE/17-SEP-2019	_int_precision_atoi() has been speed up by avoiding conversion when RADIX == the BASE representation of the number
+ * 02.03	agent/16-OCT-2026	Added the limb kernels _int_precision_pack_limbs(), _int_precision_unpack_limbs(), _int_limb_sub() and
+ *							_int_limb_mul(). _int_precision_usub() and _int_precision_umul() use them when _INT_PRECISION_LIMB_KERNELS is defined
+ * 02.04	agent/16-OCT-2026	_float_precision_usub() and _float_precision_umul() use the int_precision limb kernels when F_RADIX == RADIX.
+ *							Added _int_limb_compare() so the limb subtraction also handle mantissas with leading zeros
+ * 02.05	agent/16-OCT-2026	Added _int_limb_mul_short() and _int_limb_div_short(). _int_precision_umul_short(), _int_precision_udiv_short() and
+ *							_int_precision_urem_short() now work a limb at a time. Fixed a bug in _int_precision_usub_short() that lost the upper digits
+ *							when there was no borrow
+ * 02.06	agent/16-OCT-2026	Added _int_precision_umul_ntt() for exact multiplication of very large integers using a three prime
+ *							number theoretic transform with 32bit Montgomery arithmetic and CRT recombination
+ * 02.07	agent/16-OCT-2026	Added _int_limb_add(), _int_limb_toom3_eval() and _int_limb_toom3_mul(). _int_precision_umul() now use Toom-Cook 3 way
+ * 02.08	agent/16-OCT-2026	Added _int_limb_karatsuba_mul() that works in place in a preallocated scratch arena. _int_precision_karatsuba_umul()
+ *							use it and Toom-Cook 3 way use it below ITOOM3_THRESHOLD limbs
+ * 02.09	agent/16-OCT-2026	The multiplication thresholds are now read from precision_ctrl. Added precision_ctrl::load_thresholds() and save_thresholds()
+ * 02.10	agent/16-OCT-2026	_int_fourier() rewritten as an iterative cache blocked radix 4 transform using a persistent table of twiddle factors
+ *							from _int_fourier_roots(). _int_real_fourier() use the same table instead of a trigonometric recurrence
+ * 02.11	agent/16-OCT-2026	Added SSE2, AVX2 and NEON versions of the radix 4 fourier butterflies selected by _int_fourier_radix4()
+ * 02.12	agent/16-OCT-2026	Added _int_limb_divrem() with long division a limb at a time and Newton reciprocal with Barrett reduction for large
+ *							operands. _int_precision_udiv() and _int_precision_urem() use it and ipow_modulo() reduce with a Barrett context.
+ *							Fixed _int_precision_fastdiv() and _int_precision_fastrem() that could be one unit off for large operands
+ * 02.13	agent/16-OCT-2026	Added _int_limb_gcd() using Lehmer steps on the top two limbs and a subquadratic half gcd from
+ *							GCD_HGCD_THRESHOLD limbs. gcd() use it instead of the binary gcd on decimal strings.
+ *							Fixed _int_precision_atoi() that kept the sign in the number of a decimal string
+ * 02.14	agent/16-OCT-2026	iprime() now use a deterministic Miller-Rabin test for numbers that fit in 64 bits and the Baillie-PSW test
+ *							for larger numbers instead of trial division. Added the Montgomery kernels _int_limb_mont_init(), _int_limb_mont_mul()
+ *							and _int_limb_mont_pow() they are built on. iprime() no longer report 1 as a prime
+ * 02.15	agent/16-OCT-2026	Added the int_precision_modulus class with a Montgomery or Barrett context for a fixed modulus and sliding window
+ *							exponentiation with _int_limb_window_pow(). ipow_modulo() use it and now accept any size exponent
+ * 02.16	agent/16-OCT-2026	Added divide and conquer radix conversion _int_limb_from_binary() and _int_limb_to_binary() with a persistent table
+ *							of powers 2^(32*2^k). _int_precision_atoi() use it for hexadecimal, binary and octal strings instead of a multiplication per digit
+ * 02.17	agent/16-OCT-2026	Added the small value fast paths _float_precision_add64(), _float_precision_umul64() and _float_precision_div64()
+ *							that do float_precision +=, *= and /= with native 64bit arithmetic when the mantissas are short
+ * 02.18	agent/16-OCT-2026	_float_table() now compute the constants with binary split series (Chudnovsky for PI, sum 1/k! for e and Machin
+ *							like atanh formulas for ln(2) and ln(10)) that keep the sum so far so a higher precision only add the new terms.
+ *							Removed the spigot functions. Added _float_table_load() and _float_table_save() to keep the constants in a file
+ * 02.19	agent/16-OCT-2026	Added the binary splitting series class _float_precision_series used by _float_table() and by exp(), log(), sin(), cos()
+ *							and atan() from precision_ctrl.series_threshold() digits with the bit burst algorithm. Fixed floor() and ceil() that used an
+ *							unsigned exponent so numbers less than 0.1 was returned unchanged and exp() of such numbers never returned.
+ *							sin() and cos() now add the integer digits of the argument to the working precision of the argument reduction
+ * 02.20	agent/16-OCT-2026	_float_precision_inverse(), sqrt() and nroot() now do each Newton iteration at twice the precision of the previous
+ *							from the double seed using _float_precision_newton_steps() instead of scanning the result for convergence.
+ *							Fixed nroot() that split the exponent by 2 instead of n and could loop forever
+ * 02.21	agent/16-OCT-2026	From precision_ctrl.agm_threshold() digits log() use the arithmetic geometric mean and from
+ *							precision_ctrl.exp_newton_threshold() digits exp() use Newton iterations on log()
+ * 02.22	agent/16-OCT-2026	Added the short product _int_limb_mul_high() and _float_precision_umul_high() so *= only compute the leading
+ *							digits that survive the rounding
+ * 02.23	agent/16-OCT-2026	_float_precision_normalize() and _float_precision_strip_leading_zeros() remove the leading zeros with one erase
+ *							instead of one at a time. _float_precision_rounding() round up in place instead of building a new string
+ * 02.24	agent/16-OCT-2026	Added fma(), sum() and dot() that add the exact terms in an accumulator that never round and only round the result
+ * 02.25	agent/16-OCT-2026	_float_precision_exact_sum() sort pointers to the terms since an assignment round to the precision of the
+ *							left side. The sticky digit is build from "1" with the sign set explicit
+ * 02.26	agent/16-OCT-2026	_float_table_load() check every constant against a computed prefix and ignore the whole file if a line can not
+ *							be read or a constant is wrong instead of throwing or replacing the cached constant
+ * 02.27	agent/16-OCT-2026	Removed the binary splitting series from log(). It was slower than the arithmetic geometric mean at every
+ *							precision and with the default thresholds it could never be reached. _float_precision_atan_burst() no longer do atanh
  *
  * End of Change Record
  * --------------------------------------------------------------------------
 */
 
 /* define version string */
-static char _VIP_[] = "@(#)precisioncore.cpp 02.02 -- Copyright (C) Henrik Vestermark";
+static char _VIP_[] = "@(#)precisioncore.cpp 02.27 -- Copyright (C) Henrik Vestermark";
 
 // This is the standard Microsoft precompiled header file.
 // Please create an empty file if you are not compiling under Microsoft visual studio
@@ -109,12 +163,29 @@ static char _VIP_[] = "@(#)precisioncore.cpp 02.02 -- Copyright (C) Henrik Veste
 #include <string.h>
 #include <cstdio>
 #include <vector>
+#include <algorithm>
 
 using namespace std;
 
 #include "iprecision.h"
 #include "fprecision.h"
 
+// Select the SIMD versions of the fourier butterflies. _INT_PRECISION_SIMD_FFT is defined in iprecision.h
+#ifdef _INT_PRECISION_SIMD_FFT
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#define _INT_FOURIER_SSE2
+#include <emmintrin.h>
+#endif
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) ) && ( __GNUC__ >= 5 || defined( __clang__ ) )
+#define _INT_FOURIER_AVX2
+#include <immintrin.h>
+#endif
+#if defined( __aarch64__ ) && defined( __ARM_NEON )
+#define _INT_FOURIER_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 //
@@ -126,6 +197,71 @@ using namespace std;
 
 class precision_ctrl precision_ctrl( BASE_10, BASE_10);
 
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	precision_ctrl::load_thresholds
+///	@return 	bool	-	true if the file could be read otherwise false
+///	@param   "file"	-	The file with the thresholds
+///
+///	@todo
+///
+/// Description:
+///   Load the multiplication, division, gcd, series, agm and exp Newton thresholds from a file written by the tune program or save_thresholds()
+///   Each line holds a name and a value. Unknown names are ignored and missing names keep their current value
+//
+bool precision_ctrl::load_thresholds( const char *file )
+	{
+	FILE *fp = fopen( file, "r" );
+	char name[64];
+	unsigned long value;
+
+	if( fp == NULL )
+		return false;
+	while( fscanf( fp, "%63s %lu", name, &value ) == 2 )
+		{
+		if( strcmp( name, "karatsuba" ) == 0 ) karatsuba_threshold( value );
+		else if( strcmp( name, "toom3" ) == 0 ) toom3_threshold( value );
+		else if( strcmp( name, "mul_limb" ) == 0 ) mul_limb_threshold( value );
+		else if( strcmp( name, "mul_ntt" ) == 0 ) mul_ntt_threshold( value );
+		else if( strcmp( name, "div_newton" ) == 0 ) div_newton_threshold( value );
+		else if( strcmp( name, "gcd_hgcd" ) == 0 ) gcd_hgcd_threshold( value );
+		else if( strcmp( name, "series" ) == 0 ) series_threshold( value );
+		else if( strcmp( name, "agm" ) == 0 ) agm_threshold( value );
+		else if( strcmp( name, "exp_newton" ) == 0 ) exp_newton_threshold( value );
+		}
+	fclose( fp );
+	return true;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	precision_ctrl::save_thresholds
+///	@return 	bool	-	true if the file could be written otherwise false
+///	@param   "file"	-	The file to write
+///
+///	@todo
+///
+/// Description:
+///   Save the multiplication, division, gcd, series, agm and exp Newton thresholds in the format load_thresholds() read
+//
+bool precision_ctrl::save_thresholds( const char *file ) const
+	{
+	FILE *fp = fopen( file, "w" );
+
+	if( fp == NULL )
+		return false;
+	fprintf( fp, "karatsuba %lu\n", (unsigned long)mKaratsuba );
+	fprintf( fp, "toom3 %lu\n", (unsigned long)mToom3 );
+	fprintf( fp, "mul_limb %lu\n", (unsigned long)mMulLimb );
+	fprintf( fp, "mul_ntt %lu\n", (unsigned long)mMulNtt );
+	fprintf( fp, "div_newton %lu\n", (unsigned long)mDivNewton );
+	fprintf( fp, "gcd_hgcd %lu\n", (unsigned long)mGcdHgcd );
+	fprintf( fp, "series %lu\n", (unsigned long)mSeries );
+	fprintf( fp, "agm %lu\n", (unsigned long)mAgm );
+	fprintf( fp, "exp_newton %lu\n", (unsigned long)mExpNewton );
+	return fclose( fp ) == 0;
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 //
 //
@@ -218,8 +354,17 @@ std::string _int_precision_itoa(const int_precision *a )
 //    _int_precision_urem        -- remainder of dividing two unsinged strings
 //    _int_precision_itoa        -- Convert internal precision to BASE_10 string
 //    _int_reverse_binary        -- Reverse bit in the data buffer
+//    _int_fourier_roots         -- Persistent table of the roots of unity used by the transforms
+//    _int_cmul                  -- Complex multiplication
+//    _int_fourier_radix4_scalar -- Portable radix 4 butterfly pass
+//    _int_fourier_radix4_sse2   -- SSE2 radix 4 butterfly pass
+//    _int_fourier_radix4_avx2   -- AVX2/FMA radix 4 butterfly pass
+//    _int_fourier_radix4_neon   -- AArch64 NEON radix 4 butterfly pass
+//    _int_fourier_radix4        -- Radix 4 butterfly pass using the fastest version for the cpu
+//    _int_fourier_stages        -- Butterfly stages of the fourier transform
 //    _int_fourier               -- Fourier transformn the data
 //    _int_real_fourier          -- Convert n discrete double data into a fourier transform data set
+//    _int_precision_umul_ntt    -- multiply two unsigned strings using a number theoretic transform
 //
 
 ///	@author Henrik Vestermark (hve@hvks.com)
@@ -254,6 +399,315 @@ static void _int_reverse_binary( std::complex<double> data[], unsigned int n )
       }
    }
 
+static const unsigned int IFFT_BLOCK = 4096;	// Number of complex elements transformed as a block while it is in the level 1-2 cache
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_fourier_roots
+///	@return 	const std::complex<double> *	-	The table of roots of unity
+///	@param   "n"	-	The transform size. n must be a power of 2
+///
+///	@todo
+///
+/// Description:
+///   Return a table with at least n entries where roots[h+j]=exp(i*PI*j/h) for h=1,2,4,..,n/2 and j=0..h-1
+///   Each stage of the transform use the contiguous part roots[h..2h-1]. The table is computed once with
+///   direct calls to cos() and sin() and kept between calls. It only grows when a larger transform is needed since
+///   the entries for a smaller transform size is the first part of the table for a larger size
+//
+static const std::complex<double> *_int_fourier_roots( unsigned int n )
+	{
+	static std::vector<std::complex<double> > roots;
+	unsigned int h, j;
+
+	if( roots.size() < n )
+		{
+		h = roots.size() > 1 ? (unsigned int)roots.size() : 1;
+		roots.resize( n );
+		for( ; h < n; h <<= 1 )
+			for( j = 0; j < h; ++j )
+				roots[h+j] = std::complex<double>( cos( 3.14159265358979323846264 * j / h ), sin( 3.14159265358979323846264 * j / h ) );
+		}
+
+	return &roots[0];
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_cmul
+///	@return 	std::complex<double>	-	a*b
+///	@param   "a"	-	First complex number
+///	@param   "b"	-	Second complex number
+///
+///	@todo
+///
+/// Description:
+///   Complex multiplication without the NaN and infinity checks of the std::complex operator*
+//
+static inline std::complex<double> _int_cmul( const std::complex<double>& a, const std::complex<double>& b )
+	{
+	return std::complex<double>( a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real() );
+	}
+
+#if !defined( _INT_FOURIER_SSE2 ) && !defined( _INT_FOURIER_NEON )
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_fourier_radix4_scalar
+///	@return 	void	-
+///	@param   "data[]"	-	complex<double> fourier data in bit reversed order
+///	@param   "n"	-	number of element in data (must be a power of 2)
+///	@param   "h"	-	Half size of the first of the two butterfly stages
+///	@param   "roots"	-	The table of roots of unity from _int_fourier_roots()
+///	@param   "isign"	-	transform in(1) or out(-1)
+///
+///	@todo
+///
+/// Description:
+///   Radix 4 pass of the stages h and 2h. This is the portable version used when no SIMD version is available
+//
+static void _int_fourier_radix4_scalar( std::complex<double> data[], unsigned int n, unsigned int h, const std::complex<double> *roots, int isign )
+	{
+	unsigned int i, j;
+
+	for( i = 0; i < n; i += 4 * h )
+		for( j = 0; j < h; ++j )
+			{
+			std::complex<double> w1 = roots[h+j], w2 = roots[2*h+j];
+			if( isign < 0 ) { w1 = std::conj( w1 ); w2 = std::conj( w2 ); }
+			std::complex<double> *d = data + i + j;
+			std::complex<double> t1 = _int_cmul( w1, d[h] ), t3 = _int_cmul( w1, d[3*h] );
+			std::complex<double> b0 = d[0] + t1, b1 = d[0] - t1, b2 = d[2*h] + t3, b3 = d[2*h] - t3;
+			std::complex<double> u = _int_cmul( w2, b2 ), v = _int_cmul( w2, b3 );
+			v = isign > 0 ? std::complex<double>( -v.imag(), v.real() ) : std::complex<double>( v.imag(), -v.real() );	// v*=isign*i
+			d[0] = b0 + u;
+			d[2*h] = b0 - u;
+			d[h] = b1 + v;
+			d[3*h] = b1 - v;
+			}
+	}
+#endif
+
+#ifdef _INT_FOURIER_SSE2
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_fourier_radix4_sse2
+///	@return 	void	-
+///	@param   "data[]"	-	complex<double> fourier data in bit reversed order
+///	@param   "n"	-	number of element in data (must be a power of 2)
+///	@param   "h"	-	Half size of the first of the two butterfly stages
+///	@param   "roots"	-	The table of roots of unity from _int_fourier_roots()
+///	@param   "isign"	-	transform in(1) or out(-1)
+///
+///	@todo
+///
+/// Description:
+///   SSE2 version of _int_fourier_radix4_scalar(). A complex<double> fits exactly in one __m128d register
+///   (real part in the low lane, imaginary part in the high lane)
+//
+static void _int_fourier_radix4_sse2( std::complex<double> data[], unsigned int n, unsigned int h, const std::complex<double> *roots, int isign )
+	{
+	unsigned int i, j;
+	double *p = (double *)data;
+	const double *r = (const double *)roots;
+	const __m128d lowneg = _mm_set_pd( 0.0, -0.0 );	// Flip the sign of the real part
+	const __m128d conj = isign > 0 ? _mm_setzero_pd() : _mm_set_pd( -0.0, 0.0 );
+	const __m128d rot = isign > 0 ? lowneg : _mm_set_pd( -0.0, 0.0 );	// Sign flip after swap for v*=isign*i
+
+	for( i = 0; i < n; i += 4 * h )
+		for( j = 0; j < h; ++j )
+			{
+			double *d = p + 2 * ( i + j );
+			__m128d w1 = _mm_xor_pd( _mm_loadu_pd( r + 2 * ( h + j ) ), conj ), w2 = _mm_xor_pd( _mm_loadu_pd( r + 2 * ( 2 * h + j ) ), conj );
+			__m128d w1r = _mm_unpacklo_pd( w1, w1 ), w1i = _mm_xor_pd( _mm_unpackhi_pd( w1, w1 ), lowneg );
+			__m128d w2r = _mm_unpacklo_pd( w2, w2 ), w2i = _mm_xor_pd( _mm_unpackhi_pd( w2, w2 ), lowneg );
+			__m128d a0 = _mm_loadu_pd( d ), a1 = _mm_loadu_pd( d + 2 * h ), a2 = _mm_loadu_pd( d + 4 * h ), a3 = _mm_loadu_pd( d + 6 * h );
+			__m128d t1 = _mm_add_pd( _mm_mul_pd( w1r, a1 ), _mm_mul_pd( w1i, _mm_shuffle_pd( a1, a1, 1 ) ) );
+			__m128d t3 = _mm_add_pd( _mm_mul_pd( w1r, a3 ), _mm_mul_pd( w1i, _mm_shuffle_pd( a3, a3, 1 ) ) );
+			__m128d b0 = _mm_add_pd( a0, t1 ), b1 = _mm_sub_pd( a0, t1 ), b2 = _mm_add_pd( a2, t3 ), b3 = _mm_sub_pd( a2, t3 );
+			__m128d u = _mm_add_pd( _mm_mul_pd( w2r, b2 ), _mm_mul_pd( w2i, _mm_shuffle_pd( b2, b2, 1 ) ) );
+			__m128d v = _mm_add_pd( _mm_mul_pd( w2r, b3 ), _mm_mul_pd( w2i, _mm_shuffle_pd( b3, b3, 1 ) ) );
+			v = _mm_xor_pd( _mm_shuffle_pd( v, v, 1 ), rot );
+			_mm_storeu_pd( d, _mm_add_pd( b0, u ) );
+			_mm_storeu_pd( d + 4 * h, _mm_sub_pd( b0, u ) );
+			_mm_storeu_pd( d + 2 * h, _mm_add_pd( b1, v ) );
+			_mm_storeu_pd( d + 6 * h, _mm_sub_pd( b1, v ) );
+			}
+	}
+#endif
+
+#ifdef _INT_FOURIER_AVX2
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_fourier_radix4_avx2
+///	@return 	void	-
+///	@param   "data[]"	-	complex<double> fourier data in bit reversed order
+///	@param   "n"	-	number of element in data (must be a power of 2)
+///	@param   "h"	-	Half size of the first of the two butterfly stages. Must be even
+///	@param   "roots"	-	The table of roots of unity from _int_fourier_roots()
+///	@param   "isign"	-	transform in(1) or out(-1)
+///
+///	@todo
+///
+/// Description:
+///   AVX2/FMA version of _int_fourier_radix4_scalar() that do two butterflies j and j+1 at a time.
+///   Compiled for the avx2 target and only called when the cpu support it
+//
+__attribute__((target("avx2,fma")))
+static void _int_fourier_radix4_avx2( std::complex<double> data[], unsigned int n, unsigned int h, const std::complex<double> *roots, int isign )
+	{
+	unsigned int i, j;
+	double *p = (double *)data;
+	const double *r = (const double *)roots;
+	const __m256d conj = isign > 0 ? _mm256_setzero_pd() : _mm256_set1_pd( -0.0 );
+	const __m256d rot = isign > 0 ? _mm256_set_pd( 0.0, -0.0, 0.0, -0.0 ) : _mm256_set_pd( -0.0, 0.0, -0.0, 0.0 );
+
+	for( i = 0; i < n; i += 4 * h )
+		for( j = 0; j < h; j += 2 )
+			{
+			double *d = p + 2 * ( i + j );
+			__m256d w1 = _mm256_loadu_pd( r + 2 * ( h + j ) ), w2 = _mm256_loadu_pd( r + 2 * ( 2 * h + j ) );
+			__m256d w1r = _mm256_movedup_pd( w1 ), w1i = _mm256_xor_pd( _mm256_permute_pd( w1, 0xF ), conj );
+			__m256d w2r = _mm256_movedup_pd( w2 ), w2i = _mm256_xor_pd( _mm256_permute_pd( w2, 0xF ), conj );
+			__m256d a0 = _mm256_loadu_pd( d ), a1 = _mm256_loadu_pd( d + 2 * h ), a2 = _mm256_loadu_pd( d + 4 * h ), a3 = _mm256_loadu_pd( d + 6 * h );
+			__m256d t1 = _mm256_fmaddsub_pd( w1r, a1, _mm256_mul_pd( w1i, _mm256_permute_pd( a1, 0x5 ) ) );
+			__m256d t3 = _mm256_fmaddsub_pd( w1r, a3, _mm256_mul_pd( w1i, _mm256_permute_pd( a3, 0x5 ) ) );
+			__m256d b0 = _mm256_add_pd( a0, t1 ), b1 = _mm256_sub_pd( a0, t1 ), b2 = _mm256_add_pd( a2, t3 ), b3 = _mm256_sub_pd( a2, t3 );
+			__m256d u = _mm256_fmaddsub_pd( w2r, b2, _mm256_mul_pd( w2i, _mm256_permute_pd( b2, 0x5 ) ) );
+			__m256d v = _mm256_fmaddsub_pd( w2r, b3, _mm256_mul_pd( w2i, _mm256_permute_pd( b3, 0x5 ) ) );
+			v = _mm256_xor_pd( _mm256_permute_pd( v, 0x5 ), rot );
+			_mm256_storeu_pd( d, _mm256_add_pd( b0, u ) );
+			_mm256_storeu_pd( d + 4 * h, _mm256_sub_pd( b0, u ) );
+			_mm256_storeu_pd( d + 2 * h, _mm256_add_pd( b1, v ) );
+			_mm256_storeu_pd( d + 6 * h, _mm256_sub_pd( b1, v ) );
+			}
+	}
+#endif
+
+#ifdef _INT_FOURIER_NEON
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_fourier_radix4_neon
+///	@return 	void	-
+///	@param   "data[]"	-	complex<double> fourier data in bit reversed order
+///	@param   "n"	-	number of element in data (must be a power of 2)
+///	@param   "h"	-	Half size of the first of the two butterfly stages
+///	@param   "roots"	-	The table of roots of unity from _int_fourier_roots()
+///	@param   "isign"	-	transform in(1) or out(-1)
+///
+///	@todo
+///
+/// Description:
+///   AArch64 NEON version of _int_fourier_radix4_scalar(). A complex<double> fits in one float64x2_t register
+//
+static void _int_fourier_radix4_neon( std::complex<double> data[], unsigned int n, unsigned int h, const std::complex<double> *roots, int isign )
+	{
+	unsigned int i, j;
+	double *p = (double *)data;
+	const double *r = (const double *)roots;
+	const double sconj[2] = { 1.0, isign > 0 ? 1.0 : -1.0 }, srot[2] = { -(double)isign, (double)isign }, sneg[2] = { -1.0, 1.0 };
+	const float64x2_t conj = vld1q_f64( sconj ), rot = vld1q_f64( srot ), lowneg = vld1q_f64( sneg );
+
+	for( i = 0; i < n; i += 4 * h )
+		for( j = 0; j < h; ++j )
+			{
+			double *d = p + 2 * ( i + j );
+			float64x2_t w1 = vmulq_f64( vld1q_f64( r + 2 * ( h + j ) ), conj ), w2 = vmulq_f64( vld1q_f64( r + 2 * ( 2 * h + j ) ), conj );
+			float64x2_t w1r = vdupq_laneq_f64( w1, 0 ), w1i = vmulq_f64( vdupq_laneq_f64( w1, 1 ), lowneg );
+			float64x2_t w2r = vdupq_laneq_f64( w2, 0 ), w2i = vmulq_f64( vdupq_laneq_f64( w2, 1 ), lowneg );
+			float64x2_t a0 = vld1q_f64( d ), a1 = vld1q_f64( d + 2 * h ), a2 = vld1q_f64( d + 4 * h ), a3 = vld1q_f64( d + 6 * h );
+			float64x2_t t1 = vfmaq_f64( vmulq_f64( w1i, vextq_f64( a1, a1, 1 ) ), w1r, a1 );
+			float64x2_t t3 = vfmaq_f64( vmulq_f64( w1i, vextq_f64( a3, a3, 1 ) ), w1r, a3 );
+			float64x2_t b0 = vaddq_f64( a0, t1 ), b1 = vsubq_f64( a0, t1 ), b2 = vaddq_f64( a2, t3 ), b3 = vsubq_f64( a2, t3 );
+			float64x2_t u = vfmaq_f64( vmulq_f64( w2i, vextq_f64( b2, b2, 1 ) ), w2r, b2 );
+			float64x2_t v = vfmaq_f64( vmulq_f64( w2i, vextq_f64( b3, b3, 1 ) ), w2r, b3 );
+			v = vmulq_f64( vextq_f64( v, v, 1 ), rot );
+			vst1q_f64( d, vaddq_f64( b0, u ) );
+			vst1q_f64( d + 4 * h, vsubq_f64( b0, u ) );
+			vst1q_f64( d + 2 * h, vaddq_f64( b1, v ) );
+			vst1q_f64( d + 6 * h, vsubq_f64( b1, v ) );
+			}
+	}
+#endif
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_fourier_radix4
+///	@return 	void	-
+///	@param   "data[]"	-	complex<double> fourier data in bit reversed order
+///	@param   "n"	-	number of element in data (must be a power of 2)
+///	@param   "h"	-	Half size of the first of the two butterfly stages
+///	@param   "roots"	-	The table of roots of unity from _int_fourier_roots()
+///	@param   "isign"	-	transform in(1) or out(-1)
+///
+///	@todo
+///
+/// Description:
+///   Radix 4 pass of the stages h and 2h using the fastest version the cpu support.
+///   The AVX2 version is selected at runtime the first time it is called. SSE2 is always present on x86-64,
+///   NEON on AArch64 and everything else e.g. the MIPS target use the scalar version
+//
+static void _int_fourier_radix4( std::complex<double> data[], unsigned int n, unsigned int h, const std::complex<double> *roots, int isign )
+	{
+#if defined( _INT_FOURIER_AVX2 )
+	static const bool avx2 = __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" );
+	if( avx2 && h >= 2 )
+		{
+		_int_fourier_radix4_avx2( data, n, h, roots, isign );
+		return;
+		}
+#endif
+#if defined( _INT_FOURIER_SSE2 )
+	_int_fourier_radix4_sse2( data, n, h, roots, isign );
+#elif defined( _INT_FOURIER_NEON )
+	_int_fourier_radix4_neon( data, n, h, roots, isign );
+#else
+	_int_fourier_radix4_scalar( data, n, h, roots, isign );
+#endif
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_fourier_stages
+///	@return 	void	-
+///	@param   "data[]"	-	complex<double> fourier data in bit reversed order
+///	@param   "n"	-	number of element in data (must be a power of 2)
+///	@param   "h"	-	Half size of the first butterfly stage to do
+///	@param   "hend"	-	Stop before the stage with half size hend
+///	@param   "roots"	-	The table of roots of unity from _int_fourier_roots()
+///	@param   "isign"	-	transform in(1) or out(-1)
+///
+///	@todo
+///
+/// Description:
+///   Do the decimation in time butterfly stages h, 2h, 4h ... < hend. Two stages is combined into one radix 4 pass
+///   so the data only has to be loaded and stored once for every two stages. If the number of stages is odd
+///   a single radix 2 stage is done first
+//
+static void _int_fourier_stages( std::complex<double> data[], unsigned int n, unsigned int h, unsigned int hend, const std::complex<double> *roots, int isign )
+	{
+	unsigned int i, j, stages;
+
+	for( stages = 0, i = h; i < hend; i <<= 1 )
+		++stages;
+
+	if( stages & 1 )
+		{// Radix 2 stage
+		for( i = 0; i < n; i += 2 * h )
+			for( j = 0; j < h; ++j )
+				{
+				std::complex<double> w = roots[h+j];
+				if( isign < 0 ) w = std::conj( w );
+				std::complex<double> t = _int_cmul( w, data[i+j+h] );
+				data[i+j+h] = data[i+j] - t;
+				data[i+j] += t;
+				}
+		h <<= 1;
+		}
+
+	for( ; h < hend; h <<= 2 )
+		_int_fourier_radix4( data, n, h, roots, isign );
+	}
+
 ///	@author Henrik Vestermark (hve@hvks.com)
 ///	@date  1/19/2005
 ///	@brief 	_int_fourier do the fourier transformation
@@ -266,42 +720,22 @@ static void _int_reverse_binary( std::complex<double> data[], unsigned int n )
 ///
 /// Description:
 ///   Wk=exp(2* PI *i *j )  j=0..n/2-1
-///   exp( k * i *j ) => exp( k * i * (j-1) + k * i ) => exp( t + o ) for each new step
-///   exp( t + o ) => exp(t)-exp(t)*( 1 - cos(o) -isin(o) ) => exp(t)-exp(t)*(a-ib)
-///   => exp(t)+exp(t)*(-a+ib) => exp(t)( 1 + (-a+b) )
-///   sin(t+o)=sin(t)+[-a*sin(t)+b*cos(t)]
-///   a=2sin^2(o/2), b=sin(o)
+///   Iterative decimation in time transform. The twiddle factors Wk are taken from the persistent table
+///   _int_fourier_roots() instead of being recomputed with trigonometric recurrences for every call.
+///   The stages are done in radix 4 passes and cache blocked in blocks of IFFT_BLOCK elements
 ///   n must be a power of 2
 //
 static void _int_fourier( std::complex<double> data[], unsigned int n, int isign )
    {
-   double theta;
-   std::complex<double> w, wp;
-   unsigned long mh, m, r, j, i;
+   const std::complex<double> *roots = _int_fourier_roots( n );
+   unsigned int i, block = n < IFFT_BLOCK ? n : IFFT_BLOCK;
 
    _int_reverse_binary( data, n );
 
-   for( m = 2; n >= m; m <<= 1 )
-      {
-      theta = isign * 2 * 3.14159265358979323846264 / m;
-      wp = std::complex<double>( -2.0 * sin( 0.5 * theta ) * sin( 0.5 * theta ), sin( theta ) );
-      w = std::complex<double> ( 1, 0 ); // exp(0) == exp( isign*2*PI*i/mmax * m-1 )
-      mh = m >> 1;
-
-      for( j = 0; j < mh; j++ )      // m/2 iteration
-         {
-         for( r = 0; r <= n - m; r += m )
-            {
-            std::complex<double> tempc;
-            i = r + j;
-            tempc = w * data[ i + mh ];              // u=data[i]; v=data[j]*w; data[i]=u+v;data[j]=u-v;
-            data[ i + mh ] = data[ i ] - tempc;
-            data[ i ] += tempc;
-            }
-
-         w =  w * wp + w;  // w = w(1+wp) ==> w *=1+wp;
-         }
-      }
+   // The first stages only work within blocks of IFFT_BLOCK elements. Finish each block while it is in the cache
+   for( i = 0; i < n; i += block )
+      _int_fourier_stages( data + i, block, 1, block, roots, isign );
+   _int_fourier_stages( data, n, block, n, roots, isign );
    }
 
 
@@ -322,10 +756,10 @@ static void _int_fourier( std::complex<double> data[], unsigned int n, int isign
 void _int_real_fourier( double data[], unsigned int n, int isign )
    {
    int i;
-   double theta, c1 = 0.5, c2;
-   std::complex<double> w, wp, h1, h2;
+   double c1 = 0.5, c2;
+   std::complex<double> w, h1, h2;
+   const std::complex<double> *roots = _int_fourier_roots( n );  // roots[n/2+i]=exp(i*2*PI*i/n)
 
-   theta = 3.14159265358979323846264 / (double)( n >> 1 );
    if( isign == 1 )
       {
       c2 = -c1;
@@ -334,27 +768,25 @@ void _int_real_fourier( double data[], unsigned int n, int isign )
    else
       {
       c2 = c1;
-      theta = -theta;
       }
-   wp = std::complex<double>( -2.0 * sin( 0.5 * theta ) * sin( 0.5 * theta ), sin( theta ) );
-   w = std::complex<double> ( 1 + wp.real(), wp.imag() );
    for( i = 1; i < (int)(n>>2); i++ )
       {
       int i1, i2, i3, i4;
       std::complex<double> tc;
 
+      w = isign == 1 ? roots[ ( n >> 1 ) + i ] : std::conj( roots[ ( n >> 1 ) + i ] );
+
       i1 = i + i;
       i2 = i1 + 1;
       i3 = n + 1 - i2;
       i4 = i3 + 1;
       h1 = std::complex<double> ( c1 * ( data[i1] + data[i3] ), c1 * ( data[i2]-data[i4]));
       h2 = std::complex<double> ( -c2 * ( data[i2]+data[i4] ), c2 * ( data[i1]-data[i3]));
-      tc = w * h2;
+      tc = _int_cmul( w, h2 );
       data[i1]=h1.real()+tc.real();
       data[i2]=h1.imag()+tc.imag();
       data[i3]=h1.real() - tc.real();
       data[i4]=-h1.imag() + tc.imag();
-      w *= ( std::complex<double>(1) + wp );
       }
    if( isign == 1 )
       {
@@ -456,97 +888,2174 @@ std::string _int_precision_uneg( std::string *src )
    return des;
    }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//
+//    Limb kernels
+//
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//
+// The limb kernels packs ILIMB_DIGITS digits of the internal RADIX into one 32bit binary limb and perform
+// the unsigned arithmetic a whole limb at a time. The limb vector is stored with the least significant limb first
+// The conversion between the string and the limb vector is linear and is done once at the boundary of each kernel
+//    _int_precision_pack_limbs   -- Convert a RADIX string into a limb vector
+//    _int_precision_unpack_limbs -- Convert a limb vector into a RADIX string
+//    _int_limb_compare           -- Compare two limb vectors
+//    _int_limb_sub               -- Subtract two limb vectors
+//    _int_limb_mul               -- Multiply two limb vectors
+//    _int_limb_add               -- Add two limb vectors
+//    _int_limb_mul_short         -- Multiply a limb vector with a short number
+//    _int_limb_div_short         -- Divide a limb vector with a short number
+//    _int_limb_karatsuba_scratch -- Size of the scratch arena for Karatsuba
+//    _int_limb_karatsuba_mul     -- Multiply two limb vectors using Karatsuba
+//    _int_limb_toom3_eval        -- Evaluate a limb vector for Toom-Cook 3 way
+//    _int_limb_toom3_mul         -- Multiply two limb vectors using Toom-Cook 3 way
+//    _int_limb_mul_vec           -- Multiply two limb vectors using the fastest method
+//    _int_limb_knuth_divrem      -- Divide two limb vectors using long division
+//    _int_limb_reciprocal        -- Newton reciprocal of a limb vector
+//    _int_limb_barrett_init      -- Setup a Barrett context for repeated division with the same divisor
+//    _int_limb_barrett_step      -- Barrett reduction of a 2n limb dividend
+//    _int_limb_barrett_divrem    -- Divide with the divisor of a Barrett context
+//    _int_limb_divrem            -- Divide two limb vectors using the fastest method
+//    _int_limb_trim              -- Remove leading zero limbs
+//    _int_limb_addmul_vec        -- Multiply two limb vectors and add to a third
+//    _int_limb_matrix_mul        -- Multiply two half gcd matrices
+//    _int_limb_matrix_mul_1      -- Multiply a half gcd matrix with a matrix of single limbs
+//    _int_limb_lehmer_step       -- Lehmer reduction using the top limbs
+//    _int_limb_subdiv_step       -- One Euclid division step
+//    _int_limb_hgcd_adjust       -- Apply the reduction of the top limbs to the full numbers
+//    _int_limb_hgcd_step         -- One Lehmer or division step
+//    _int_limb_hgcd              -- Half gcd
+//    _int_limb_gcd               -- Greatest common divisor of two limb vectors
+//    _int_limb_mont_init         -- Setup a Montgomery context for an odd modulus
+//    _int_limb_mont_mul          -- Montgomery multiplication
+//    _int_limb_modmul            -- Modular multiplication with a Montgomery or Barrett context
+//    _int_limb_window_pow        -- Sliding window modular exponentiation
+//    _int_limb_binary_power      -- Persistent table of the powers 2^(32*2^k) used by the radix conversion
+//    _int_limb_to_binary         -- Convert a limb vector to 32bit binary words
+//    _int_limb_from_binary       -- Convert 32bit binary words to a limb vector
+//    _int_limb_mont_add          -- Modular addition
+//    _int_limb_mont_sub          -- Modular subtraction
+//    _int_limb_mont_half         -- Modular halving
+//    _int_limb_mont_small        -- Convert a small signed number to Montgomery form
+//    _int_limb_strong_probable_prime -- Miller-Rabin test
+//    _int_limb_strong_lucas      -- Strong Lucas probable prime test
+//    _int_limb_jacobi            -- Jacobi symbol of a small number over a limb vector
+//
 
-///	@author Henrik Vestermark (hve@hvks.com)
-///	@date  1/14/2005
-///	@brief 		std::string _int_precision_uadd_short
-///	@return 		std::string - 	the result of the add
-///	@param      "src1"	-	Source string to add short number
-///	@param      "d"	   -	Number to add.
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_precision_pack_limbs
+///	@return 	void	-
+///	@param   "des"	-	The resulting limb vector. Least significant limb first
+///	@param   "src"	-	The unsigned RADIX string to pack
 ///
 ///	@todo
 ///
 /// Description:
-///   Short Add: The digit d [0..RADIX] is added to the unsigned decimal string
-///   Optimized 0 add or early out add is implemented
-///   Please note that uadd_short will throw an exception if d is larger than the
-///   RADIX of the internal representation. e.g. is RADIX is BASE_10 then d can
-///   be in the range of 0..10. If base is BASE_2 the d can only be in the range
-///   from 0..2
+///   Pack ILIMB_DIGITS radix digits into each binary limb starting from the least significant digit
+///   The most significant limb may hold fewer digits
 //
-std::string _int_precision_uadd_short( std::string *src1, unsigned int d )
-   {
-   unsigned short ireg;
-   std::string::reverse_iterator r1_pos;
-   std::string::reverse_iterator rd_pos;
-   std::string des1;
+static void _int_precision_pack_limbs( std::vector<ilimb_t>& des, const std::string *src )
+	{
+	const char *p = src->data();
+	size_t i, k, start, pos = src->length();
+	ilimb_t v;
 
-   if( d > (unsigned)RADIX )
-      { throw int_precision::out_of_range();      }
+	des.resize( ( pos + ILIMB_DIGITS - 1 ) / ILIMB_DIGITS );
+	for( i = 0; i < des.size(); ++i, pos = start )
+		{
+		start = pos >= (size_t)ILIMB_DIGITS ? pos - ILIMB_DIGITS : 0;
+		for( v = 0, k = start; k < pos; ++k )
+			v = v * RADIX + IDIGIT( p[k] );
+		des[i] = v;
+		}
+	}
 
-   if( d == 0 )   // Zero add
-      return *src1;
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_precision_unpack_limbs
+///	@return 	std::string	-	The unsigned RADIX string
+///	@param   "src"	-	Pointer to the limb vector. Least significant limb first
+///	@param   "n"	-	Number of limbs in src
+///
+///	@todo
+///
+/// Description:
+///   Unpack the limb vector into a RADIX string. Non significant leading zero limbs are skipped
+///   so the result is always stripped for leading zeros
+//
+static std::string _int_precision_unpack_limbs( const ilimb_t *src, size_t n )
+	{
+	std::string des;
+	size_t i, pos, top_digits;
+	ilimb_t v;
+	int k;
 
-   ireg = (unsigned short)( RADIX * d );
-   des1 = *src1;
-   rd_pos = des1.rbegin();
-   r1_pos = src1->rbegin();
+	for( ; n > 0 && src[n-1] == 0; --n ) ;
+	if( n == 0 )
+		{
+		des = ICHARACTER(0);
+		return des;
+		}
 
-   for(; r1_pos != src1->rend(); ++r1_pos, ++rd_pos )
-      {
-      ireg = (unsigned short)( IDIGIT( *r1_pos ) + ICARRY( ireg ) );
-      *rd_pos = ICHARACTER( (unsigned char)ISINGLE( ireg ) );
-      if( ICARRY( ireg ) == 0 ) // Early out add
-         break;
-      }
+	for( top_digits = 0, v = src[n-1]; v != 0; v /= RADIX )
+		++top_digits;
+	des.resize( ( n - 1 ) * ILIMB_DIGITS + top_digits );
+	pos = des.length();
+	for( i = 0; i < n - 1; ++i )
+		for( v = src[i], k = ILIMB_DIGITS; k > 0; --k, v /= RADIX )
+			des[--pos] = ICHARACTER( (unsigned char)( v % RADIX ) );
+	for( v = src[n-1]; v != 0; v /= RADIX )
+		des[--pos] = ICHARACTER( (unsigned char)( v % RADIX ) );
+
+	return des;
+	}
 
-   if( ICARRY( ireg ) != 0 )  // Insert the carry in the front of the number
-      des1.insert( (std::string::size_type)0, 1, ICHARACTER( (unsigned char)ICARRY( ireg ) ) );
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_compare
+///	@return 	int	-	0==equal, 1==a>b, -1==a<b
+///	@param   "a"	-	First limb vector
+///	@param   "na"	-	Number of limbs in a
+///	@param   "b"	-	Second limb vector
+///	@param   "nb"	-	Number of limbs in b
+///
+///	@todo
+///
+/// Description:
+///   Compare two limb vectors. Unlike _int_precision_compare() leading zero limbs are allowed
+//
+static int _int_limb_compare( const ilimb_t *a, size_t na, const ilimb_t *b, size_t nb )
+	{
+	for( ; na > 0 && a[na-1] == 0; --na ) ;
+	for( ; nb > 0 && b[nb-1] == 0; --nb ) ;
+	if( na != nb )
+		return na > nb ? 1 : -1;
+	for( ; na > 0; --na )
+		if( a[na-1] != b[na-1] )
+			return a[na-1] > b[na-1] ? 1 : -1;
+
+	return 0;
+	}
 
-   _int_precision_strip_leading_zeros( &des1 );
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_sub
+///	@return 	ilimb_t	-	The borrow out of the most significant limb
+///	@param   "des"	-	The result with room for na limbs. Can be the same as a
+///	@param   "a"	-	First limb vector
+///	@param   "na"	-	Number of limbs in a
+///	@param   "b"	-	Second limb vector
+///	@param   "nb"	-	Number of limbs in b. nb <= na
+///
+///	@todo
+///
+/// Description:
+///   Subtract two limb vectors des=a-b and return the borrow. A borrow of 1 means that a < b
+//
+static ilimb_t _int_limb_sub( ilimb_t *des, const ilimb_t *a, size_t na, const ilimb_t *b, size_t nb )
+	{
+	ilimb_t borrow = 0;
+	size_t i;
 
-   return des1;
-   }
+	for( i = 0; i < nb; ++i )
+		{
+		uint64_t t = (uint64_t)b[i] + borrow;
+		if( a[i] >= t ) { des[i] = (ilimb_t)( a[i] - t ); borrow = 0; }
+		else { des[i] = (ilimb_t)( ILIMB_BASE + a[i] - t ); borrow = 1; }
+		}
+	for( ; i < na; ++i )
+		{
+		if( a[i] >= borrow ) { des[i] = a[i] - borrow; borrow = 0; }
+		else { des[i] = (ilimb_t)( ILIMB_BASE - 1 ); }
+		}
 
+	return borrow;
+	}
 
-///	@author Henrik Vestermark (hve@hvks.com)
-///	@date  1/14/2005
-///	@brief 	std::string _int_precision_uadd
-///	@return 	std::string	-	the result of adding src1 and src2
-///	@param   "src1"	-	First unsigned source argument
-///	@param   "src2"	-	Second unsigned source argument
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_mul
+///	@return 	void	-
+///	@param   "des"	-	The result with room for na+nb limbs. Must not overlap a or b
+///	@param   "a"	-	First limb vector
+///	@param   "na"	-	Number of limbs in a
+///	@param   "b"	-	Second limb vector
+///	@param   "nb"	-	Number of limbs in b
 ///
 ///	@todo
 ///
 /// Description:
-///   Add two unsigned decimal strings
-///   Optimized: Used early out add
+///   Multiply two limb vectors des=a*b using the schoolbook method on whole limbs
+///   (ILIMB_BASE-1)^2+2*(ILIMB_BASE-1) always fit into a 64bit unsigned integer so each step can be done using
+///   native 64bit arithmetic
 //
-std::string _int_precision_uadd( std::string *src1, std::string *src2 )
-   {
-   unsigned short ireg = 0;
-   std::string des1;
-   std::string::reverse_iterator r_pos, r_end;
-   std::string::reverse_iterator rd_pos;
+static void _int_limb_mul( ilimb_t *des, const ilimb_t *a, size_t na, const ilimb_t *b, size_t nb )
+	{
+	size_t i, j;
 
-   if( src1->length() >= src2->length() )
-      {
-      des1 = *src1;
-      r_pos = src2->rbegin();
-      r_end = src2->rend();
-      }
-   else
-      {
-      des1 = *src2;
-      r_pos = src1->rbegin();
-      r_end = src1->rend();
-      }
-   rd_pos = des1.rbegin();
+	for( i = 0; i < na + nb; ++i )
+		des[i] = 0;
+	for( i = 0; i < na; ++i )
+		{
+		uint64_t carry = 0, ai = a[i];
+		if( ai == 0 )
+			continue;
+		for( j = 0; j < nb; ++j )
+			{
+			uint64_t t = ai * b[j] + des[i+j] + carry;
+			carry = t / ILIMB_BASE;
+			des[i+j] = (ilimb_t)( t - carry * ILIMB_BASE );
+			}
+		des[i+nb] = (ilimb_t)carry;
+		}
+	}
 
-   for( ; r_pos != r_end; )
-      { // Adding element by element for the two numbers
-      ireg = (unsigned char)( IDIGIT( *r_pos ) + IDIGIT( *rd_pos ) + ICARRY( ireg ) );
-      *rd_pos = ICHARACTER( (unsigned char)ISINGLE( ireg ) );
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_add
+///	@return 	ilimb_t	-	The carry out of the most significant limb
+///	@param   "des"	-	The result with room for na limbs. May be the same as a
+///	@param   "a"	-	First limb vector
+///	@param   "na"	-	Number of limbs in a
+///	@param   "b"	-	Second limb vector
+///	@param   "nb"	-	Number of limbs in b. nb <= na
+///
+///	@todo
+///
+/// Description:
+///   Add two limb vectors des=a+b and return the carry
+//
+static ilimb_t _int_limb_add( ilimb_t *des, const ilimb_t *a, size_t na, const ilimb_t *b, size_t nb )
+	{
+	ilimb_t carry = 0;
+	size_t i;
+
+	for( i = 0; i < nb; ++i )
+		{
+		uint64_t t = (uint64_t)a[i] + b[i] + carry;
+		if( t >= ILIMB_BASE ) { des[i] = (ilimb_t)( t - ILIMB_BASE ); carry = 1; }
+		else { des[i] = (ilimb_t)t; carry = 0; }
+		}
+	for( ; i < na; ++i )
+		{
+		if( carry == 0 && des == a )
+			break;	// Early out when adding in place
+		uint64_t t = (uint64_t)a[i] + carry;
+		if( t >= ILIMB_BASE ) { des[i] = (ilimb_t)( t - ILIMB_BASE ); carry = 1; }
+		else { des[i] = (ilimb_t)t; carry = 0; }
+		}
+
+	return carry;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_mul_short
+///	@return 	ilimb_t	-	The carry out of the most significant limb
+///	@param   "des"	-	The result with room for n limbs. May be the same as a
+///	@param   "a"	-	The limb vector
+///	@param   "n"	-	Number of limbs in a
+///	@param   "d"	-	The short multiplier [0..RADIX]
+///
+///	@todo
+///
+/// Description:
+///   Multiply a limb vector with a short number des=a*d
+//
+static ilimb_t _int_limb_mul_short( ilimb_t *des, const ilimb_t *a, size_t n, unsigned int d )
+	{
+	uint64_t carry = 0;
+
+	for( size_t i = 0; i < n; ++i )
+		{
+		uint64_t t = (uint64_t)a[i] * d + carry;
+		carry = t / ILIMB_BASE;
+		des[i] = (ilimb_t)( t - carry * ILIMB_BASE );
+		}
+
+	return (ilimb_t)carry;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_div_short
+///	@return 	unsigned int	-	The remainder of the division
+///	@param   "des"	-	The quotient with room for n limbs. May be the same as a. If NULL only the remainder is calculated
+///	@param   "a"	-	The limb vector
+///	@param   "n"	-	Number of limbs in a
+///	@param   "d"	-	The short divisor [1..RADIX]
+///
+///	@todo
+///
+/// Description:
+///   Divide a limb vector with a short number des=a/d starting from the most significant limb
+///   This only needs one hardware division per limb instead of one per radix digit
+//
+static unsigned int _int_limb_div_short( ilimb_t *des, const ilimb_t *a, size_t n, unsigned int d )
+	{
+	uint64_t rem = 0;
+
+	for( size_t i = n; i > 0; --i )
+		{
+		uint64_t t = rem * ILIMB_BASE + a[i-1];
+		uint64_t q = t / d;
+		rem = t - q * d;
+		if( des != NULL )
+			des[i-1] = (ilimb_t)q;
+		}
+
+	return (unsigned int)rem;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_karatsuba_scratch
+///	@return 	size_t	-	Number of scratch limbs needed
+///	@param   "n"	-	Number of limbs in the largest operand
+///
+///	@todo
+///
+/// Description:
+///   Return the size of the scratch arena _int_limb_karatsuba_mul() needs for operands of up to n limbs
+///   Each level of recursion use 4h+4 limbs where h=(n+1)/2 and recurse on operands of h+1 limbs
+//
+static size_t _int_limb_karatsuba_scratch( size_t n )
+	{
+	size_t s = 0;
+
+	for( ; n >= precision_ctrl.karatsuba_threshold(); n = ( n + 1 ) / 2 + 1 )
+		s += 4 * ( ( n + 1 ) / 2 ) + 4;
+	return s;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_karatsuba_mul
+///	@return 	void	-
+///	@param   "des"	-	The result with room for na+nb limbs. Must not overlap a, b or scratch
+///	@param   "a"	-	First limb vector
+///	@param   "na"	-	Number of limbs in a
+///	@param   "b"	-	Second limb vector
+///	@param   "nb"	-	Number of limbs in b
+///	@param   "scratch"	-	Scratch arena of at least _int_limb_karatsuba_scratch(max(na,nb)) limbs
+///
+///	@todo
+///
+/// Description:
+///   Multiply two limb vectors des=a*b using the Karatsuba method
+///   All the temporaries live in the scratch arena that is allocated once by the caller, so no memory is allocated
+///   during the recursion. With a=a1*x+a0 and b=b1*x+b0 where x=ILIMB_BASE^h
+///      z0=a0*b0, z2=a1*b1, z1=(a0+a1)*(b0+b1)-z0-z2 and des=z2*x^2+z1*x+z0
+///   z0 and z2 are calculated directly into des. Below precision_ctrl.karatsuba_threshold() limbs the schoolbook _int_limb_mul() is used
+///   Unbalanced operands is done in slices of the smallest operand
+//
+static void _int_limb_karatsuba_mul( ilimb_t *des, const ilimb_t *a, size_t na, const ilimb_t *b, size_t nb, ilimb_t *scratch )
+	{
+	if( na < nb )
+		{ std::swap( a, b ); std::swap( na, nb ); }
+
+	if( nb < precision_ctrl.karatsuba_threshold() )
+		{
+		_int_limb_mul( des, a, na, b, nb );
+		return;
+		}
+
+	size_t i, h = ( na + 1 ) / 2, n = na + nb;
+	if( nb <= h )
+		{// Unbalanced. Multiply a slice of nb limbs at a time and add it to the result
+		ilimb_t *t = scratch;
+
+		std::fill( des, des + n, 0 );
+		for( i = 0; i < na; i += nb )
+			{
+			size_t ns = na - i < nb ? na - i : nb;
+			_int_limb_karatsuba_mul( t, a + i, ns, b, nb, scratch + 2 * nb );
+			_int_limb_add( des + i, des + i, n - i, t, ns + nb );
+			}
+		return;
+		}
+
+	ilimb_t *sa = scratch, *sb = sa + h + 1, *z1 = sb + h + 1, *next = z1 + 2 * h + 2;
+
+	// sa=a0+a1, sb=b0+b1
+	std::copy( a, a + h, sa ); sa[h] = 0;
+	_int_limb_add( sa, sa, h + 1, a + h, na - h );
+	std::copy( b, b + h, sb ); sb[h] = 0;
+	_int_limb_add( sb, sb, h + 1, b + h, nb - h );
+
+	// z0 and z2 directly into des. z1=(a0+a1)*(b0+b1)-z0-z2
+	_int_limb_karatsuba_mul( des, a, h, b, h, next );
+	_int_limb_karatsuba_mul( des + 2 * h, a + h, na - h, b + h, nb - h, next );
+	_int_limb_karatsuba_mul( z1, sa, h + 1, sb, h + 1, next );
+	_int_limb_sub( z1, z1, 2 * h + 2, des, 2 * h );
+	_int_limb_sub( z1, z1, 2 * h + 2, des + 2 * h, n - 2 * h );
+
+	// Add z1*x. The top limbs of z1 is zero if they fall outside des
+	_int_limb_add( des + h, des + h, n - h, z1, n - h < 2 * h + 2 ? n - h : 2 * h + 2 );
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_toom3_eval
+///	@return 	int	-	The sign of the value at -1
+///	@param   "a"	-	The limb vector to evaluate
+///	@param   "n"	-	Number of limbs in a. 2k < n <= 3k
+///	@param   "k"	-	Number of limbs in each of the three parts a0, a1 and a2
+///	@param   "p1"	-	Return |a(1)| in k+1 limbs
+///	@param   "pm1"	-	Return |a(-1)| in k+1 limbs
+///	@param   "p2"	-	Return |a(2)| in k+1 limbs
+///
+///	@todo
+///
+/// Description:
+///   Evaluate the polynomial a(x)=a0+a1*x+a2*x^2 where x=ILIMB_BASE^k at the points 1, -1 and 2
+///   All the values fit into k+1 limbs since a(2) < 7*ILIMB_BASE^k
+//
+static int _int_limb_toom3_eval( const ilimb_t *a, size_t n, size_t k, std::vector<ilimb_t>& p1, std::vector<ilimb_t>& pm1, std::vector<ilimb_t>& p2 )
+	{
+	const ilimb_t *a0 = a, *a1 = a + k, *a2 = a + 2 * k;
+	size_t n2 = n - 2 * k;
+	int sign = 1;
+
+	p1.assign( a0, a0 + k ); p1.push_back( 0 );
+	_int_limb_add( &p1[0], &p1[0], k + 1, a2, n2 );	// a0+a2
+	pm1.assign( k + 1, 0 );
+	if( _int_limb_compare( &p1[0], k + 1, a1, k ) >= 0 )
+		_int_limb_sub( &pm1[0], &p1[0], k + 1, a1, k );
+	else
+		{
+		std::copy( a1, a1 + k, pm1.begin() );
+		_int_limb_sub( &pm1[0], &pm1[0], k + 1, &p1[0], k + 1 );
+		sign = -1;
+		}
+	_int_limb_add( &p1[0], &p1[0], k + 1, a1, k );	// a0+a1+a2
+
+	p2.assign( k + 1, 0 );
+	std::copy( a2, a2 + n2, p2.begin() );
+	_int_limb_mul_short( &p2[0], &p2[0], k + 1, 2 );
+	_int_limb_add( &p2[0], &p2[0], k + 1, a1, k );
+	_int_limb_mul_short( &p2[0], &p2[0], k + 1, 2 );
+	_int_limb_add( &p2[0], &p2[0], k + 1, a0, k );	// a0+2*a1+4*a2
+
+	return sign;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_toom3_mul
+///	@return 	void	-
+///	@param   "des"	-	The result with room for na+nb limbs. Must not overlap a or b
+///	@param   "a"	-	First limb vector
+///	@param   "na"	-	Number of limbs in a
+///	@param   "b"	-	Second limb vector
+///	@param   "nb"	-	Number of limbs in b
+///
+///	@todo
+///
+/// Description:
+///   Multiply two limb vectors des=a*b using the Toom-Cook 3 way method
+///   The operands are split into three parts and evaluated in the points 0, 1, -1, 2 and infinity. This replace 9 multiplications
+///   of a third of the size with 5. The points are choosen so only the value at -1 can be negative and the interpolation can be done
+///   using unsigned arithmetic with only exact divisions by 2 and 3:
+///      E=(r(1)+r(-1))/2, O=(r(1)-r(-1))/2
+///      c2=E-c0-c4, c3=((r(2)-c0-4*c2-16*c4)/2-O)/3, c1=O-c3
+///   Below precision_ctrl.toom3_threshold() limbs _int_limb_karatsuba_mul() is used. Unbalanced operands is done in slices of the smallest operand
+//
+static void _int_limb_toom3_mul( ilimb_t *des, const ilimb_t *a, size_t na, const ilimb_t *b, size_t nb )
+	{
+	if( na < nb )
+		{ std::swap( a, b ); std::swap( na, nb ); }
+
+	if( nb < precision_ctrl.toom3_threshold() )
+		{
+		std::vector<ilimb_t> scratch( _int_limb_karatsuba_scratch( na ) + 1 );
+		_int_limb_karatsuba_mul( des, a, na, b, nb, &scratch[0] );
+		return;
+		}
+
+	size_t i, k = ( na + 2 ) / 3, n = na + nb;
+	if( nb <= 2 * k )
+		{// Unbalanced. Multiply a slice of nb limbs at a time and add it to the result
+		std::vector<ilimb_t> t( 2 * nb );
+
+		std::fill( des, des + n, 0 );
+		for( i = 0; i < na; i += nb )
+			{
+			size_t ns = na - i < nb ? na - i : nb;
+			_int_limb_toom3_mul( &t[0], a + i, ns, b, nb );
+			_int_limb_add( des + i, des + i, n - i, &t[0], ns + nb );
+			}
+		return;
+		}
+
+	// Evaluation
+	std::vector<ilimb_t> pa1, pam1, pa2, pb1, pbm1, pb2;
+	int sign = _int_limb_toom3_eval( a, na, k, pa1, pam1, pa2 ) * _int_limb_toom3_eval( b, nb, k, pb1, pbm1, pb2 );
+
+	// Pointwise multiplication. All the values are stored in L limbs
+	size_t L = 2 * k + 2;
+	std::vector<ilimb_t> r0( L, 0 ), r1( L ), rm1( L ), r2( L ), rinf( L, 0 ), t( L );
+	_int_limb_toom3_mul( &r0[0], a, k, b, k );
+	_int_limb_toom3_mul( &r1[0], &pa1[0], k + 1, &pb1[0], k + 1 );
+	_int_limb_toom3_mul( &rm1[0], &pam1[0], k + 1, &pbm1[0], k + 1 );
+	_int_limb_toom3_mul( &r2[0], &pa2[0], k + 1, &pb2[0], k + 1 );
+	_int_limb_toom3_mul( &rinf[0], a + 2 * k, na - 2 * k, b + 2 * k, nb - 2 * k );
+
+	// Interpolation. r1 becomes E and rm1 becomes O
+	if( sign > 0 )
+		{
+		_int_limb_sub( &t[0], &r1[0], L, &rm1[0], L );
+		_int_limb_add( &r1[0], &r1[0], L, &rm1[0], L );
+		}
+	else
+		{
+		_int_limb_add( &t[0], &r1[0], L, &rm1[0], L );
+		_int_limb_sub( &r1[0], &r1[0], L, &rm1[0], L );
+		}
+	_int_limb_div_short( &r1[0], &r1[0], L, 2 );
+	_int_limb_div_short( &rm1[0], &t[0], L, 2 );
+	_int_limb_sub( &r1[0], &r1[0], L, &r0[0], L );
+	_int_limb_sub( &r1[0], &r1[0], L, &rinf[0], L );	// c2
+	_int_limb_sub( &r2[0], &r2[0], L, &r0[0], L );
+	_int_limb_mul_short( &t[0], &r1[0], L, 4 );
+	_int_limb_sub( &r2[0], &r2[0], L, &t[0], L );
+	_int_limb_mul_short( &t[0], &rinf[0], L, 16 );
+	_int_limb_sub( &r2[0], &r2[0], L, &t[0], L );
+	_int_limb_div_short( &r2[0], &r2[0], L, 2 );
+	_int_limb_sub( &r2[0], &r2[0], L, &rm1[0], L );
+	_int_limb_div_short( &r2[0], &r2[0], L, 3 );	// c3
+	_int_limb_sub( &rm1[0], &rm1[0], L, &r2[0], L );	// c1
+
+	// Recomposition des=c0+c1*x+c2*x^2+c3*x^3+c4*x^4
+	std::fill( des, des + n, 0 );
+	const ilimb_t *c[5] = { &r0[0], &rm1[0], &r1[0], &r2[0], &rinf[0] };
+	for( i = 0; i < 5 && i * k < n; ++i )
+		_int_limb_add( des + i * k, des + i * k, n - i * k, c[i], n - i * k < L ? n - i * k : L );
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_mul_vec
+///	@return 	void	-
+///	@param   "des"	-	The result. Resized to na+nb limbs
+///	@param   "a"	-	First limb vector
+///	@param   "na"	-	Number of limbs in a
+///	@param   "b"	-	Second limb vector
+///	@param   "nb"	-	Number of limbs in b
+///
+///	@todo
+///
+/// Description:
+///   Multiply two limb vectors des=a*b with the same choice of algorithm as int_precision::operator*=
+///   Operands with leading zero limbs or zero length are allowed. From precision_ctrl.mul_limb_threshold() digits
+///   the operands are unpacked and multiplied with the transform multiplication
+//
+static void _int_limb_mul_vec( std::vector<ilimb_t>& des, const ilimb_t *a, size_t na, const ilimb_t *b, size_t nb )
+	{
+	size_t n = na + nb;
+
+	for( ; na > 0 && a[na-1] == 0; --na ) ;
+	for( ; nb > 0 && b[nb-1] == 0; --nb ) ;
+	des.assign( n > 0 ? n : 1, 0 );
+	if( na == 0 || nb == 0 )
+		return;
+	if( ( na < nb ? na : nb ) * ILIMB_DIGITS >= precision_ctrl.mul_limb_threshold() )
+		{
+		std::string s1 = _int_precision_unpack_limbs( a, na ), s2 = _int_precision_unpack_limbs( b, nb ), s3;
+		std::vector<ilimb_t> c;
+
+		if( ( s1.length() < s2.length() ? s1.length() : s2.length() ) >= precision_ctrl.mul_ntt_threshold() )
+			s3 = _int_precision_umul_ntt( &s1, &s2 );
+		else
+			s3 = _int_precision_umul_fourier( &s1, &s2 );
+		_int_precision_pack_limbs( c, &s3 );
+		std::copy( c.begin(), c.begin() + ( c.size() < n ? c.size() : n ), des.begin() );
+		return;
+		}
+	_int_limb_toom3_mul( &des[0], a, na, b, nb );
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_mul_high
+///	@return 	void	-
+///	@param   "des"	-	The result with room for 2n limbs
+///	@param   "a"	-	First limb vector
+///	@param   "b"	-	Second limb vector
+///	@param   "n"	-	Number of limbs in a and b
+///
+///	@todo
+///
+/// Description:
+///   Short product. Only the partial products a[i]*b[j] with i+j>=n-1 are guaranteed to be added so des is a lower bound
+///   of a*b that is less than n*ILIMB_BASE^n below it. Small n use the schoolbook method on these partial products.
+///   Larger n use Mulders split with k about 0.7n: The top k limbs of a and b are multiplied in full with _int_limb_mul_vec()
+///   and the rest is two short products of n-k limbs of the low part of one operand and the high part of the other
+//
+static void _int_limb_mul_high( ilimb_t *des, const ilimb_t *a, const ilimb_t *b, size_t n )
+	{
+	size_t i, j, k;
+
+	if( n < precision_ctrl.karatsuba_threshold() )
+		{
+		std::fill( des, des + 2 * n, 0 );
+		for( i = 0; i < n; ++i )
+			{
+			uint64_t carry = 0, ai = a[i];
+			if( ai == 0 )
+				continue;
+			for( j = n - 1 - i; j < n; ++j )
+				{
+				uint64_t t = ai * b[j] + des[i+j] + carry;
+				carry = t / ILIMB_BASE;
+				des[i+j] = (ilimb_t)( t - carry * ILIMB_BASE );
+				}
+			des[i+n] = (ilimb_t)carry;
+			}
+		return;
+		}
+
+	std::vector<ilimb_t> t;
+
+	k = n - n * 3 / 10;
+	_int_limb_mul_vec( t, a + n - k, k, b + n - k, k );
+	std::fill( des, des + 2 * ( n - k ), 0 );
+	std::copy( t.begin(), t.begin() + 2 * k, des + 2 * ( n - k ) );
+	t.resize( 2 * ( n - k ) );
+	_int_limb_mul_high( &t[0], a, b + k, n - k );
+	_int_limb_add( des + k, des + k, 2 * n - k, &t[0], 2 * ( n - k ) );
+	_int_limb_mul_high( &t[0], b, a + k, n - k );
+	_int_limb_add( des + k, des + k, 2 * n - k, &t[0], 2 * ( n - k ) );
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_knuth_divrem
+///	@return 	void	-
+///	@param   "q"	-	The quotient with room for na-nb+1 limbs or NULL
+///	@param   "r"	-	The remainder with room for nb limbs or NULL
+///	@param   "a"	-	Dividend limb vector
+///	@param   "na"	-	Number of limbs in a. na >= nb
+///	@param   "b"	-	Divisor limb vector
+///	@param   "nb"	-	Number of limbs in b. nb >= 2 and b[nb-1]!=0
+///
+///	@todo
+///
+/// Description:
+///   Long division q=a/b, r=a%b a limb at a time using Knuth algorithm D. The operands are first normalized
+///   with the factor f=ILIMB_BASE/(b[nb-1]+1) so the top limb of the divisor is at least ILIMB_BASE/2. The estimated quotient
+///   limb from the top two limbs is then at most 2 too large and the test against the second limb of the divisor make
+///   it almost always exact. The remainder is unnormalized by a short division with f
+//
+static void _int_limb_knuth_divrem( ilimb_t *q, ilimb_t *r, const ilimb_t *a, size_t na, const ilimb_t *b, size_t nb )
+	{
+	const uint64_t B = ILIMB_BASE;
+	unsigned int f = (unsigned int)( B / ( b[nb-1] + 1 ) );
+	std::vector<ilimb_t> u( na + 1 ), v( nb );
+	size_t i, j;
+
+	u[na] = _int_limb_mul_short( &u[0], a, na, f );
+	_int_limb_mul_short( &v[0], b, nb, f );
+	for( j = na - nb + 1; j-- > 0; )
+		{
+		uint64_t num = (uint64_t)u[j+nb] * B + u[j+nb-1];
+		uint64_t qhat = num / v[nb-1], rhat = num % v[nb-1];
+		uint64_t carry = 0;
+		int64_t t, borrow = 0;
+
+		while( qhat >= B || qhat * v[nb-2] > rhat * B + u[j+nb-2] )
+			{
+			--qhat;
+			rhat += v[nb-1];
+			if( rhat >= B )
+				break;
+			}
+
+		// Multiply and subtract u[j..j+nb]-=qhat*v
+		for( i = 0; i < nb; ++i )
+			{
+			uint64_t p = qhat * v[i] + carry;
+			carry = p / B;
+			t = (int64_t)u[i+j] - (int64_t)( p % B ) - borrow;
+			borrow = t < 0;
+			u[i+j] = (ilimb_t)( t + ( borrow ? B : 0 ) );
+			}
+		t = (int64_t)u[j+nb] - (int64_t)carry - borrow;
+		if( t < 0 )
+			{// qhat was one too large. Add v back
+			--qhat;
+			for( carry = 0, i = 0; i < nb; ++i )
+				{
+				uint64_t s = (uint64_t)u[i+j] + v[i] + carry;
+				carry = s >= B;
+				u[i+j] = (ilimb_t)( s - ( carry ? B : 0 ) );
+				}
+			t += carry;
+			}
+		u[j+nb] = (ilimb_t)t;
+		if( q != NULL )
+			q[j] = (ilimb_t)qhat;
+		}
+
+	if( r != NULL )
+		_int_limb_div_short( r, &u[0], nb, f );
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_reciprocal
+///	@return 	void	-
+///	@param   "x"	-	The reciprocal. Resized to n+1 limbs
+///	@param   "b"	-	Normalized limb vector. b[n-1]>=ILIMB_BASE/2
+///	@param   "n"	-	Number of limbs in b
+///
+///	@todo
+///
+/// Description:
+///   Find x=ILIMB_BASE^(2n)/b within a few units of the last limb using Newton iteration with precision doubling.
+///   The reciprocal xh of the top h=n/2+1 limbs of b is found recursively. xh*ILIMB_BASE^(n-h) is then correct to about n limbs
+///   and one Newton step x=x0+x0*(1-b*x0) doubles the number of correct limbs:
+///      e=ILIMB_BASE^(n+h)-b*xh, x=xh*ILIMB_BASE^(n-h)+xh*e/ILIMB_BASE^(2h)
+///   The extra limb in h keep the rounding errors from growing through the recursion.
+///   Below precision_ctrl.div_newton_threshold() limbs the reciprocal is found by long division
+//
+static void _int_limb_reciprocal( std::vector<ilimb_t>& x, const ilimb_t *b, size_t n )
+	{
+	if( n < precision_ctrl.div_newton_threshold() || n < 8 )
+		{
+		std::vector<ilimb_t> u( 2 * n, (ilimb_t)( ILIMB_BASE - 1 ) );
+
+		x.assign( n + 1, 0 );
+		_int_limb_knuth_divrem( &x[0], NULL, &u[0], 2 * n, b, n );
+		return;
+		}
+
+	size_t h = n / 2 + 1, i;
+	std::vector<ilimb_t> xh, p, t;
+	bool negative;
+
+	_int_limb_reciprocal( xh, b + n - h, h );
+
+	// e=ILIMB_BASE^(n+h)-b*xh. p holds |e| and negative its sign
+	_int_limb_mul_vec( p, b, n, &xh[0], xh.size() );
+	p.resize( n + h + 1, 0 );
+	negative = p[n+h] != 0;
+	if( negative )
+		--p[n+h];
+	else
+		{
+		std::vector<ilimb_t> zero( n + h, 0 );
+		_int_limb_sub( &p[0], &zero[0], n + h, &p[0], n + h );
+		}
+
+	// x=xh*ILIMB_BASE^(n-h)+-xh*e/ILIMB_BASE^(2h)
+	_int_limb_mul_vec( t, &xh[0], xh.size(), &p[0], p.size() );
+	x.assign( n + 2, 0 );
+	for( i = 0; i < xh.size(); ++i )
+		x[n-h+i] = xh[i];
+	if( t.size() > 2 * h )
+		{
+		if( negative )
+			_int_limb_sub( &x[0], &x[0], x.size(), &t[2*h], std::min( t.size() - 2 * h, x.size() ) );
+		else
+			_int_limb_add( &x[0], &x[0], x.size(), &t[2*h], std::min( t.size() - 2 * h, x.size() ) );
+		}
+	x.resize( n + 1 );
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_barrett_init
+///	@return 	void	-
+///	@param   "ctx"	-	The Barrett context to initialize
+///	@param   "b"	-	Divisor limb vector. Must not be zero
+///	@param   "nb"	-	Number of limbs in b
+///
+///	@todo
+///
+/// Description:
+///   Normalize the divisor and find its reciprocal if it is at least precision_ctrl.div_newton_threshold() limbs
+//
+static void _int_limb_barrett_init( _int_limb_barrett& ctx, const ilimb_t *b, size_t nb )
+	{
+	for( ; nb > 1 && b[nb-1] == 0; --nb ) ;
+	ctx.f = (unsigned int)( ILIMB_BASE / ( b[nb-1] + 1 ) );
+	ctx.b.resize( nb );
+	_int_limb_mul_short( &ctx.b[0], b, nb, ctx.f );
+	ctx.inv.clear();
+	if( nb >= precision_ctrl.div_newton_threshold() && nb >= 8 )
+		_int_limb_reciprocal( ctx.inv, &ctx.b[0], nb );
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_barrett_step
+///	@return 	void	-
+///	@param   "ctx"	-	The Barrett context
+///	@param   "q"	-	The quotient with room for n limbs
+///	@param   "u"	-	The normalized dividend with 2n limbs and u<b*ILIMB_BASE^n. Replaced with the remainder
+///
+///	@todo
+///
+/// Description:
+///   One Barrett reduction of a 2n limb dividend with the n limb normalized divisor. The quotient is estimated from the
+///   top n+1 limbs of u and the reciprocal and is at most a few units off. It is then corrected using the remainder
+//
+static void _int_limb_barrett_step( const _int_limb_barrett& ctx, ilimb_t *q, std::vector<ilimb_t>& u )
+	{
+	const size_t n = ctx.b.size();
+	std::vector<ilimb_t> t, qb;
+	size_t i;
+
+	_int_limb_mul_vec( t, &u[n-1], n + 1, &ctx.inv[0], ctx.inv.size() );
+	t.resize( 2 * n + 2, 0 );
+	for( i = 0; i < n; ++i )
+		q[i] = t[2*n+1] != 0 ? (ilimb_t)( ILIMB_BASE - 1 ) : t[n+1+i];	// The quotient is less than ILIMB_BASE^n
+	_int_limb_mul_vec( qb, q, n, &ctx.b[0], n );
+	qb.resize( 2 * n + 1, 0 );
+	u.resize( 2 * n + 1, 0 );
+	while( _int_limb_compare( &qb[0], qb.size(), &u[0], u.size() ) > 0 )
+		{// Estimate too large
+		std::vector<ilimb_t> one( 1, 1 );
+		_int_limb_sub( q, q, n, &one[0], 1 );
+		_int_limb_sub( &qb[0], &qb[0], qb.size(), &ctx.b[0], n );
+		}
+	_int_limb_sub( &u[0], &u[0], u.size(), &qb[0], qb.size() );
+	while( _int_limb_compare( &u[0], u.size(), &ctx.b[0], n ) >= 0 )
+		{// Estimate too small
+		std::vector<ilimb_t> one( 1, 1 );
+		_int_limb_add( q, q, n, &one[0], 1 );
+		_int_limb_sub( &u[0], &u[0], u.size(), &ctx.b[0], n );
+		}
+	u.resize( n );
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_barrett_divrem
+///	@return 	void	-
+///	@param   "ctx"	-	The Barrett context of the divisor b
+///	@param   "q"	-	The quotient or NULL. Resized to na limbs
+///	@param   "r"	-	The remainder or NULL. Resized to n limbs
+///	@param   "a"	-	Dividend limb vector
+///	@param   "na"	-	Number of limbs in a
+///
+///	@todo
+///
+/// Description:
+///   Divide a with the divisor of the Barrett context. The normalized dividend a*f is divided n limbs at a time from the top
+///   where the remainder of the previous step is the top n limbs of the next 2n limb step
+//
+static void _int_limb_barrett_divrem( const _int_limb_barrett& ctx, std::vector<ilimb_t> *q, std::vector<ilimb_t> *r, const ilimb_t *a, size_t na )
+	{
+	const size_t n = ctx.b.size();
+	std::vector<ilimb_t> an( na + 1 ), u, rem( n, 0 );
+	size_t i, s;
+
+	an[na] = _int_limb_mul_short( &an[0], a, na, ctx.f );
+	for( ++na; na > 1 && an[na-1] == 0; --na ) ;
+	if( q != NULL )
+		q->assign( na + 1, 0 );
+
+	if( n == 1 )
+		{// Short division
+		unsigned int rd = _int_limb_div_short( q != NULL ? &(*q)[0] : NULL, &an[0], na, ctx.b[0] );
+		rem[0] = rd;
+		}
+	else
+	if( ctx.inv.empty() )
+		{
+		if( na >= n )
+			_int_limb_knuth_divrem( q != NULL ? &(*q)[0] : NULL, &rem[0], &an[0], na, &ctx.b[0], n );
+		else
+			std::copy( an.begin(), an.begin() + na, rem.begin() );
+		}
+	else
+		{
+		std::vector<ilimb_t> qs( n );
+		for( i = na; i > 0; i = s )
+			{
+			s = i > n ? i - n : 0;
+			u.assign( an.begin() + s, an.begin() + i );	// u=rem*ILIMB_BASE^(i-s)+a[s..i-1]
+			u.resize( 2 * n, 0 );
+			std::copy( rem.begin(), rem.end(), u.begin() + ( i - s ) );
+			_int_limb_barrett_step( ctx, &qs[0], u );
+			rem = u;
+			if( q != NULL )
+				for( size_t j = 0; j < i - s; ++j )
+					(*q)[s+j] = qs[j];
+			}
+		}
+
+	if( r != NULL )
+		{
+		r->resize( n );
+		_int_limb_div_short( &(*r)[0], &rem[0], n, ctx.f );
+		}
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_divrem
+///	@return 	void	-
+///	@param   "q"	-	The quotient or NULL
+///	@param   "r"	-	The remainder or NULL
+///	@param   "a"	-	Dividend limb vector
+///	@param   "na"	-	Number of limbs in a
+///	@param   "b"	-	Divisor limb vector. Must not be zero
+///	@param   "nb"	-	Number of limbs in b
+///
+///	@todo
+///
+/// Description:
+///   Divide two limb vectors q=a/b, r=a%b choosing the fastest method.
+///   Long division is O(nb*(na-nb)) so it is used when either the divisor or the quotient is shorter than precision_ctrl.div_newton_threshold()
+///   limbs. A quotient much shorter than the divisor only depends on the top limbs of the operands so the quotient is found from the
+///   top 2(na-nb)+2 limbs of a and the top na-nb+2 limbs of b and then corrected by at most two units using the full remainder.
+///   Otherwise the division is done by Barrett reduction with the Newton reciprocal of b, which scale like the multiplication
+//
+static void _int_limb_divrem( std::vector<ilimb_t> *q, std::vector<ilimb_t> *r, const ilimb_t *a, size_t na, const ilimb_t *b, size_t nb )
+	{
+	for( ; na > 0 && a[na-1] == 0; --na ) ;
+	for( ; nb > 1 && b[nb-1] == 0; --nb ) ;
+
+	if( _int_limb_compare( a, na, b, nb ) < 0 )
+		{
+		if( q != NULL ) q->assign( 1, 0 );
+		if( r != NULL ) { r->assign( a, a + na ); if( na == 0 ) r->assign( 1, 0 ); }
+		return;
+		}
+
+	size_t m = na - nb;
+	const size_t threshold = precision_ctrl.div_newton_threshold() > 8 ? precision_ctrl.div_newton_threshold() : 8;
+	if( nb == 1 || nb < threshold || m + 1 < threshold )
+		{
+		if( q != NULL ) q->assign( m + 1, 0 );
+		if( r != NULL ) r->assign( nb, 0 );
+		if( nb == 1 )
+			{
+			unsigned int rd = _int_limb_div_short( q != NULL ? &(*q)[0] : NULL, a, na, b[0] );
+			if( r != NULL ) (*r)[0] = rd;
+			}
+		else
+			_int_limb_knuth_divrem( q != NULL ? &(*q)[0] : NULL, r != NULL ? &(*r)[0] : NULL, a, na, b, nb );
+		return;
+		}
+
+	if( 2 * ( m + 2 ) <= nb )
+		{// Short quotient. Find it from the top limbs and correct it with the remainder
+		size_t s = nb - ( m + 2 );
+		std::vector<ilimb_t> qt, qb, one( 1, 1 ), rt( na + 1, 0 );
+
+		_int_limb_divrem( &qt, NULL, a + s, na - s, b + s, nb - s );
+		_int_limb_mul_vec( qb, &qt[0], qt.size(), b, nb );
+		qb.resize( na + 1, 0 );
+		std::copy( a, a + na, rt.begin() );
+		while( _int_limb_compare( &qb[0], qb.size(), &rt[0], rt.size() ) > 0 )
+			{
+			_int_limb_sub( &qt[0], &qt[0], qt.size(), &one[0], 1 );
+			_int_limb_sub( &qb[0], &qb[0], qb.size(), b, nb );
+			}
+		_int_limb_sub( &rt[0], &rt[0], rt.size(), &qb[0], qb.size() );
+		while( _int_limb_compare( &rt[0], rt.size(), b, nb ) >= 0 )
+			{
+			qt.push_back( 0 );
+			_int_limb_add( &qt[0], &qt[0], qt.size(), &one[0], 1 );
+			_int_limb_sub( &rt[0], &rt[0], rt.size(), b, nb );
+			}
+		if( q != NULL ) q->swap( qt );
+		if( r != NULL ) { rt.resize( nb ); r->swap( rt ); }
+		return;
+		}
+
+	_int_limb_barrett ctx;
+	_int_limb_barrett_init( ctx, b, nb );
+	_int_limb_barrett_divrem( ctx, q, r, a, na );
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	struct _int_limb_matrix
+///
+/// Description:
+///   2x2 matrix of non negative limb vectors with determinant 1 used by the half gcd. It keeps track of the reduction
+///   of the pair (a,b) so the original pair is M*(a,b)
+//
+struct _int_limb_matrix {
+	std::vector<ilimb_t> m11, m12, m21, m22;
+	_int_limb_matrix() : m11( 1, 1 ), m12( 1, 0 ), m21( 1, 0 ), m22( 1, 1 ) {}
+	};
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_trim
+///	@return 	size_t	-	The number of significant limbs. 0 if the number is zero
+///	@param   "a"	-	Limb vector. Leading zero limbs are removed but at least one limb is kept
+///
+///	@todo
+///
+/// Description:
+///   Remove leading zero limbs
+//
+static size_t _int_limb_trim( std::vector<ilimb_t>& a )
+	{
+	size_t n = a.size();
+
+	for( ; n > 0 && a[n-1] == 0; --n ) ;
+	a.resize( n > 0 ? n : 1 );
+	if( n == 0 )
+		a[0] = 0;
+	return n;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_addmul_vec
+///	@return 	void	-
+///	@param   "des"	-	Limb vector. des+=a*b
+///	@param   "a"	-	First limb vector
+///	@param   "b"	-	Second limb vector
+///
+///	@todo
+///
+/// Description:
+///   Multiply two limb vectors and add the result to des which is grown as needed
+//
+static void _int_limb_addmul_vec( std::vector<ilimb_t>& des, const std::vector<ilimb_t>& a, const std::vector<ilimb_t>& b )
+	{
+	std::vector<ilimb_t> t;
+
+	_int_limb_mul_vec( t, &a[0], a.size(), &b[0], b.size() );
+	_int_limb_trim( t );
+	if( des.size() < t.size() + 1 )
+		des.resize( t.size() + 1, 0 );
+	else
+		des.push_back( 0 );
+	_int_limb_add( &des[0], &des[0], des.size(), &t[0], t.size() );
+	_int_limb_trim( des );
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_matrix_mul
+///	@return 	void	-
+///	@param   "m"	-	The matrix. m=m*n
+///	@param   "n"	-	The matrix to multiply with
+///
+///	@todo
+///
+/// Description:
+///   Multiply two half gcd matrices
+//
+static void _int_limb_matrix_mul( _int_limb_matrix& m, const _int_limb_matrix& n )
+	{
+	_int_limb_matrix r;
+
+	r.m11.assign( 1, 0 ); r.m22.assign( 1, 0 );
+	_int_limb_addmul_vec( r.m11, m.m11, n.m11 ); _int_limb_addmul_vec( r.m11, m.m12, n.m21 );
+	_int_limb_addmul_vec( r.m12, m.m11, n.m12 ); _int_limb_addmul_vec( r.m12, m.m12, n.m22 );
+	_int_limb_addmul_vec( r.m21, m.m21, n.m11 ); _int_limb_addmul_vec( r.m21, m.m22, n.m21 );
+	_int_limb_addmul_vec( r.m22, m.m21, n.m12 ); _int_limb_addmul_vec( r.m22, m.m22, n.m22 );
+	m = r;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_matrix_mul_1
+///	@return 	void	-
+///	@param   "m"	-	The matrix. m=m*u
+///	@param   "u11"	-	Element of u. Less than ILIMB_BASE
+///	@param   "u12"	-	Element of u. Less than ILIMB_BASE
+///	@param   "u21"	-	Element of u. Less than ILIMB_BASE
+///	@param   "u22"	-	Element of u. Less than ILIMB_BASE
+///
+///	@todo
+///
+/// Description:
+///   Multiply a half gcd matrix with a matrix of single limbs. Each row is done in one pass
+//
+static void _int_limb_matrix_mul_1( _int_limb_matrix& m, uint64_t u11, uint64_t u12, uint64_t u21, uint64_t u22 )
+	{
+	std::vector<ilimb_t> *row[2][2] = { { &m.m11, &m.m12 }, { &m.m21, &m.m22 } };
+
+	for( int k = 0; k < 2; ++k )
+		{
+		std::vector<ilimb_t> &x = *row[k][0], &y = *row[k][1];
+		size_t n = std::max( x.size(), y.size() );
+		uint64_t c1 = 0, c2 = 0;
+
+		x.resize( n + 2, 0 ); y.resize( n + 2, 0 );	// The carry can be up to 2*ILIMB_BASE
+		for( size_t i = 0; i < n + 2; ++i )
+			{
+			uint64_t t1 = x[i] * u11 + y[i] * u21 + c1, t2 = x[i] * u12 + y[i] * u22 + c2;
+			c1 = t1 / ILIMB_BASE; x[i] = (ilimb_t)( t1 - c1 * ILIMB_BASE );
+			c2 = t2 / ILIMB_BASE; y[i] = (ilimb_t)( t2 - c2 * ILIMB_BASE );
+			}
+		_int_limb_trim( x ); _int_limb_trim( y );
+		}
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_floor_div
+///	@return 	int64_t	-	floor(t/ILIMB_BASE). t is replaced with t mod ILIMB_BASE
+///	@param   "t"	-	The signed value
+///
+///	@todo
+///
+/// Description:
+///   Split a signed value into a limb and a signed carry
+//
+static inline int64_t _int_limb_floor_div( int64_t& t )
+	{
+	int64_t c = t / (int64_t)ILIMB_BASE;
+
+	t -= c * (int64_t)ILIMB_BASE;
+	if( t < 0 )
+		{ t += ILIMB_BASE; --c; }
+	return c;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_lehmer_step
+///	@return 	bool	-	true if a reduction was done otherwise false
+///	@param   "a"	-	First limb vector
+///	@param   "b"	-	Second limb vector
+///	@param   "s"	-	Both a and b must keep more than s limbs
+///	@param   "m"	-	The matrix to update or NULL
+///
+///	@todo
+///
+/// Description:
+///   Do as many Euclid steps as possible using only the top limbs of a and b (Lehmer) and then update the full
+///   numbers in one pass. The steps are done in place as a-=q*b or b-=q*a and collected in the matrix u so (a,b)=u*(a',b').
+///   The top three limbs are scaled down to two limbs x,y so the current values are within (x-u12,x+u22) and (y-u21,y+u11) times the scale.
+///   A quotient is only accepted if it is the same at both ends of the intervals (Knuth) so every step is an exact
+///   step of the full numbers. The entries of u are kept below ILIMB_BASE so the update can be done with 64bit arithmetic
+//
+static bool _int_limb_lehmer_step( std::vector<ilimb_t>& a, std::vector<ilimb_t>& b, size_t s, _int_limb_matrix *m )
+	{
+	const int64_t LIMIT = (int64_t)ILIMB_BASE;
+	size_t n = a.size() > b.size() ? a.size() : b.size(), i;
+	int64_t x = 0, y = 0, u11 = 1, u12 = 0, u21 = 0, u22 = 1, least;
+	uint64_t d, ra = 0, rb = 0;
+	bool reduced = false;
+
+	if( n < 3 || n < s + 1 )
+		return false;
+	a.resize( n, 0 ); b.resize( n, 0 );
+	// x=a/D and y=b/D with D=d*ILIMB_BASE^(n-3) chosen so x and y has close to two full limbs
+	d = (uint64_t)std::max( a[n-1], b[n-1] ) + 1;
+	for( i = n; i-- > n - 3; )
+		{
+		ra = ra * ILIMB_BASE + a[i]; x = x * LIMIT + (int64_t)( ra / d ); ra %= d;
+		rb = rb * ILIMB_BASE + b[i]; y = y * LIMIT + (int64_t)( rb / d ); rb %= d;
+		}
+	// The reduced numbers must stay at or above ILIMB_BASE^s. Find the least value of x or y that guarantee that
+	least = s + 3 <= n ? 1 : s + 2 == n ? (int64_t)( ( ILIMB_BASE + d - 1 ) / d ) : (int64_t)( ( ILIMB_BASE * ILIMB_BASE + d - 1 ) / d );
+	for( ;; )
+		{
+		if( x >= y )
+			{// a-=q*b
+			if( y - u21 <= 0 ) break;
+			int64_t q = ( x - u12 ) / ( y + u11 );
+			if( q == 0 || q != ( x + u22 ) / ( y - u21 ) || q >= LIMIT ) break;
+			int64_t n12 = u12 + q * u11, n22 = u22 + q * u21;
+			if( n12 >= LIMIT || n22 >= LIMIT || x - q * y - n12 < least ) break;
+			x -= q * y; u12 = n12; u22 = n22;
+			}
+		else
+			{// b-=q*a
+			if( x - u12 <= 0 ) break;
+			int64_t q = ( y - u21 ) / ( x + u22 );
+			if( q == 0 || q != ( y + u11 ) / ( x - u12 ) || q >= LIMIT ) break;
+			int64_t n11 = u11 + q * u12, n21 = u21 + q * u22;
+			if( n11 >= LIMIT || n21 >= LIMIT || y - q * x - n21 < least ) break;
+			y -= q * x; u11 = n11; u21 = n21;
+			}
+		reduced = true;
+		}
+
+	if( reduced == false )
+		{
+		_int_limb_trim( a ); _int_limb_trim( b );
+		return false;
+		}
+
+	// (a,b)=(u22*a-u12*b,u11*b-u21*a)
+	int64_t ca = 0, cb = 0;
+	for( i = 0; i < n; ++i )
+		{
+		int64_t ta = u22 * a[i] - u12 * b[i] + ca, tb = u11 * b[i] - u21 * a[i] + cb;
+		ca = _int_limb_floor_div( ta );
+		cb = _int_limb_floor_div( tb );
+		a[i] = (ilimb_t)ta;
+		b[i] = (ilimb_t)tb;
+		}
+	_int_limb_trim( a ); _int_limb_trim( b );
+
+	if( m != NULL )
+		_int_limb_matrix_mul_1( *m, u11, u12, u21, u22 );
+
+	return true;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_subdiv_step
+///	@return 	bool	-	true if a reduction was done otherwise false
+///	@param   "a"	-	First limb vector
+///	@param   "b"	-	Second limb vector
+///	@param   "s"	-	Both a and b must keep more than s limbs. If s is 0 the step can reduce one of them to zero
+///	@param   "m"	-	The matrix to update or NULL
+///
+///	@todo
+///
+/// Description:
+///   One division step of the largest number with the smallest. If the remainder would be s limbs or less
+///   the quotient is reduced by one which always leaves more than s limbs
+//
+static bool _int_limb_subdiv_step( std::vector<ilimb_t>& a, std::vector<ilimb_t>& b, size_t s, _int_limb_matrix *m )
+	{
+	size_t na = _int_limb_trim( a ), nb = _int_limb_trim( b );
+	int c = _int_limb_compare( &a[0], na, &b[0], nb );
+	bool swap = c < 0;
+	std::vector<ilimb_t> &big = swap ? b : a, &small = swap ? a : b, q, r;
+
+	if( c == 0 && s > 0 )
+		return false;
+	if( ( swap ? na : nb ) <= s )
+		return false;
+
+	_int_limb_divrem( &q, &r, &big[0], big.size(), &small[0], small.size() );
+	if( s > 0 && _int_limb_trim( r ) <= s )
+		{// Too far. Use q-1
+		std::vector<ilimb_t> one( 1, 1 );
+		_int_limb_sub( &q[0], &q[0], q.size(), &one[0], 1 );
+		if( _int_limb_trim( q ) == 0 )
+			return false;
+		r.resize( ( r.size() > small.size() ? r.size() : small.size() ) + 1, 0 );
+		_int_limb_add( &r[0], &r[0], r.size(), &small[0], small.size() );
+		}
+	_int_limb_trim( r );
+	big.swap( r );
+
+	if( m != NULL )
+		{// a-=q*b give m12+=q*m11, m22+=q*m21. b-=q*a give m11+=q*m12, m21+=q*m22
+		_int_limb_trim( q );
+		if( q.size() == 1 )
+			_int_limb_matrix_mul_1( *m, 1, swap ? 0 : q[0], swap ? q[0] : 0, 1 );
+		else if( swap )
+			{ _int_limb_addmul_vec( m->m11, q, m->m12 ); _int_limb_addmul_vec( m->m21, q, m->m22 ); }
+		else
+			{ _int_limb_addmul_vec( m->m12, q, m->m11 ); _int_limb_addmul_vec( m->m22, q, m->m21 ); }
+		}
+
+	return true;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_hgcd_adjust
+///	@return 	bool	-	true if the reduction was applied
+///	@param   "a"	-	First limb vector. Replaced with the reduced value
+///	@param   "b"	-	Second limb vector. Replaced with the reduced value
+///	@param   "p"	-	The number of low limbs that was not part of the reduction
+///	@param   "at"	-	The reduced top part of a (a>>p limbs)
+///	@param   "bt"	-	The reduced top part of b (b>>p limbs)
+///	@param   "m"	-	The matrix of the reduction of the top parts
+///
+///	@todo
+///
+/// Description:
+///   Apply the reduction of the top parts to the full numbers. Since (a,b)=m*(a',b') and det(m)=1
+///      a'=at*ILIMB_BASE^p+m22*alow-m12*blow
+///      b'=bt*ILIMB_BASE^p+m11*blow-m21*alow
+///   The half gcd reduce the top parts so the results are known to be positive.
+//
+static bool _int_limb_hgcd_adjust( std::vector<ilimb_t>& a, std::vector<ilimb_t>& b, size_t p, const std::vector<ilimb_t>& at, const std::vector<ilimb_t>& bt, const _int_limb_matrix& m )
+	{
+	std::vector<ilimb_t> alow( a.begin(), a.begin() + std::min( p, a.size() ) ), blow( b.begin(), b.begin() + std::min( p, b.size() ) );
+	std::vector<ilimb_t> na, nb, t1, t2;
+	const std::vector<ilimb_t> *top[2] = { &at, &bt }, *mp[2] = { &m.m22, &m.m11 }, *mn[2] = { &m.m12, &m.m21 }, *lp[2] = { &alow, &blow }, *ln[2] = { &blow, &alow };
+	std::vector<ilimb_t> *res[2] = { &na, &nb };
+
+	if( alow.empty() ) alow.assign( 1, 0 );
+	if( blow.empty() ) blow.assign( 1, 0 );
+	for( int k = 0; k < 2; ++k )
+		{
+		std::vector<ilimb_t>& r = *res[k];
+		_int_limb_mul_vec( t1, &(*mp[k])[0], mp[k]->size(), &(*lp[k])[0], lp[k]->size() );
+		_int_limb_mul_vec( t2, &(*mn[k])[0], mn[k]->size(), &(*ln[k])[0], ln[k]->size() );
+		size_t n = std::max( p + top[k]->size(), std::max( t1.size(), t2.size() ) ) + 1;
+		r.assign( n, 0 );
+		std::copy( top[k]->begin(), top[k]->end(), r.begin() + p );
+		_int_limb_add( &r[0], &r[0], n, &t1[0], t1.size() );
+		if( _int_limb_sub( &r[0], &r[0], n, &t2[0], t2.size() ) != 0 )
+			return false;	// Can not happen. Keep the numbers unchanged
+		_int_limb_trim( r );
+		}
+	a.swap( na );
+	b.swap( nb );
+	return true;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_hgcd_step
+///	@return 	bool	-	true if a reduction was done
+///	@param   "a"	-	First limb vector
+///	@param   "b"	-	Second limb vector
+///	@param   "s"	-	Both a and b must keep more than s limbs
+///	@param   "m"	-	The matrix to update or NULL
+///
+///	@todo
+///
+/// Description:
+///   One reduction step. A Lehmer step if possible otherwise a division step
+//
+static bool _int_limb_hgcd_step( std::vector<ilimb_t>& a, std::vector<ilimb_t>& b, size_t s, _int_limb_matrix *m )
+	{
+	if( _int_limb_lehmer_step( a, b, s, m ) )
+		return true;
+	return _int_limb_subdiv_step( a, b, s, m );
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_hgcd
+///	@return 	bool	-	true if a reduction was done
+///	@param   "a"	-	First limb vector
+///	@param   "b"	-	Second limb vector
+///	@param   "m"	-	The matrix of the reduction. Must be the identity matrix on entry
+///
+///	@todo
+///
+/// Description:
+///   Half gcd. With n the number of limbs in the largest of a and b the pair is reduced while both keep more than s=n/2+1 limbs.
+///   This is about half of the remainder sequence and the matrix entries are at most about n/2 limbs.
+///   The first half of the reduction is done recursively on the top n-n/2 limbs and applied to the full numbers.
+///   The reduction of the top limbs is valid for the full numbers as long as the top parts keep more than half of their size (Moller).
+///   A few single steps bring the size down to 3n/4 and the second recursive call then reduce the top 2(n-s) limbs down to s.
+///   Below precision_ctrl.gcd_hgcd_threshold() limbs only Lehmer and division steps are used. The total cost is O(M(n)log(n))
+//
+static bool _int_limb_hgcd( std::vector<ilimb_t>& a, std::vector<ilimb_t>& b, _int_limb_matrix& m )
+	{
+	size_t n = std::max( _int_limb_trim( a ), _int_limb_trim( b ) ), s = n / 2 + 1, n2 = ( 3 * n ) / 4 + 1, p;
+	bool success = false;
+
+	if( n <= s )
+		return false;
+
+	if( n >= precision_ctrl.gcd_hgcd_threshold() && n >= 8 )
+		{
+		for( int pass = 0; pass < 2; ++pass )
+			{
+			if( pass == 1 )
+				{// Single steps down to 3n/4 before the second recursive call
+				while( std::max( a.size(), b.size() ) > n2 )
+					{
+					if( !_int_limb_hgcd_step( a, b, s, &m ) )
+						return success;
+					success = true;
+					}
+				size_t nn = std::max( a.size(), b.size() );
+				if( nn <= s + 2 )
+					break;
+				p = 2 * s - nn + 1;
+				}
+			else
+				p = n / 2;
+
+			if( p >= a.size() || p >= b.size() )
+				continue;
+			_int_limb_matrix m1;
+			std::vector<ilimb_t> at( a.begin() + p, a.end() ), bt( b.begin() + p, b.end() );
+			if( _int_limb_hgcd( at, bt, m1 ) && _int_limb_hgcd_adjust( a, b, p, at, bt, m1 ) )
+				{
+				_int_limb_matrix_mul( m, m1 );
+				success = true;
+				}
+			}
+		}
+
+	while( _int_limb_hgcd_step( a, b, s, &m ) )
+		success = true;
+
+	return success;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_gcd
+///	@return 	void	-
+///	@param   "a"	-	First limb vector. Replaced with the gcd
+///	@param   "b"	-	Second limb vector. Destroyed
+///
+///	@todo
+///
+/// Description:
+///   Greatest common divisor of two limb vectors.
+///   From precision_ctrl.gcd_hgcd_threshold() limbs the half gcd of the top 2n/3 limbs reduce the numbers with about n/3 limbs at a time.
+///   Below that Lehmer steps using the top limbs do up to 9 digits of reduction per pass over the numbers and the last
+///   two limbs are done with native 64bit arithmetic
+//
+static void _int_limb_gcd( std::vector<ilimb_t>& a, std::vector<ilimb_t>& b )
+	{
+	size_t na = _int_limb_trim( a ), nb = _int_limb_trim( b );
+
+	for( ; na > 2 && nb > 0; na = _int_limb_trim( a ), nb = _int_limb_trim( b ) )
+		{
+		size_t n = std::max( na, nb ), p = n / 3;
+
+		if( na > nb + 1 || nb > na + 1 )
+			{// Very different sizes. Do a division step first
+			_int_limb_subdiv_step( a, b, 0, NULL );
+			continue;
+			}
+		if( n >= precision_ctrl.gcd_hgcd_threshold() && n >= 8 && p < na && p < nb )
+			{
+			_int_limb_matrix m;
+			std::vector<ilimb_t> at( a.begin() + p, a.end() ), bt( b.begin() + p, b.end() );
+			if( _int_limb_hgcd( at, bt, m ) && _int_limb_hgcd_adjust( a, b, p, at, bt, m ) )
+				continue;
+			}
+		if( !_int_limb_lehmer_step( a, b, 0, NULL ) )
+			_int_limb_subdiv_step( a, b, 0, NULL );
+		}
+
+	if( na == 0 || nb == 0 )
+		{
+		if( na == 0 )
+			a.swap( b );
+		_int_limb_trim( a );
+		return;
+		}
+
+	// Both fit in 64 bits
+	uint64_t u = a[0] + ( na > 1 ? (uint64_t)a[1] * ILIMB_BASE : 0 ), v = b[0] + ( nb > 1 ? (uint64_t)b[1] * ILIMB_BASE : 0 );
+	if( na > 2 || nb > 2 )
+		{// One is still large. One division step bring it down
+		_int_limb_subdiv_step( a, b, 0, NULL );
+		_int_limb_gcd( a, b );
+		return;
+		}
+	while( v != 0 )
+		{
+		uint64_t t = u % v;
+		u = v;
+		v = t;
+		}
+	a.assign( 2, 0 );
+	a[0] = (ilimb_t)( u % ILIMB_BASE );
+	a[1] = (ilimb_t)( u / ILIMB_BASE );
+	_int_limb_trim( a );
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_mont_init
+///	@return 	void	-
+///	@param   "ctx"	-	The Montgomery context to setup
+///	@param   "m"	-	The modulus limb vector
+///	@param   "nm"	-	Number of limbs in m
+///
+///	@todo
+///
+/// Description:
+///   Setup a Montgomery context. m^-1 mod ILIMB_BASE is found by Newton iteration x=x*(2-m*x) which double the number of
+///   correct digits each time. The start value is correct modulo the product of the prime factors of ILIMB_BASE (10 or 2)
+//
+static void _int_limb_mont_init( _int_limb_montgomery& ctx, const ilimb_t *m, size_t nm )
+	{
+	const uint64_t rad = ILIMB_BASE % 5 == 0 ? 10 : 2;
+	uint64_t x, m0;
+	std::vector<ilimb_t> p;
+
+	for( ; nm > 1 && m[nm-1] == 0; --nm ) ;
+	ctx.m.assign( m, m + nm );
+	m0 = m[0];
+	for( x = 1; ( m0 * x ) % rad != 1; ++x ) ;
+	for( int i = 0; i < 6; ++i )
+		x = x * ( ( ILIMB_BASE + 2 - m0 * x % ILIMB_BASE ) % ILIMB_BASE ) % ILIMB_BASE;
+	ctx.minv = ( ILIMB_BASE - x ) % ILIMB_BASE;
+
+	p.assign( nm + 1, 0 ); p[nm] = 1;		// R
+	_int_limb_divrem( NULL, &ctx.one, &p[0], p.size(), m, nm );
+	ctx.one.resize( nm, 0 );
+	p.assign( 2 * nm + 1, 0 ); p[2*nm] = 1;	// R^2
+	_int_limb_divrem( NULL, &ctx.r2, &p[0], p.size(), m, nm );
+	ctx.r2.resize( nm, 0 );
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_mont_mul
+///	@return 	void	-
+///	@param   "ctx"	-	The Montgomery context
+///	@param   "des"	-	The result a*b*R^-1 mod m with room for n limbs. Can be the same as a or b
+///	@param   "a"	-	First factor. n limbs less than m
+///	@param   "b"	-	Second factor. n limbs less than m
+///
+///	@todo
+///
+/// Description:
+///   Montgomery multiplication. Below precision_ctrl.karatsuba_threshold() limbs the coarsely integrated operand scanning
+///   method (CIOS) is used. For each limb of b the partial product is added and the lowest limb is cleared by adding a multiple
+///   of m and shifting one limb, so the intermediate result never exceeds n+2 limbs. For larger moduli the full product is
+///   found with _int_limb_mul_vec() and then reduced by n clearing steps
+//
+static void _int_limb_mont_mul( const _int_limb_montgomery& ctx, ilimb_t *des, const ilimb_t *a, const ilimb_t *b )
+	{
+	const size_t n = ctx.m.size();
+	const ilimb_t *m = &ctx.m[0];
+	std::vector<ilimb_t> t;
+	size_t i, j;
+	uint64_t c, s, q;
+
+	if( n >= precision_ctrl.karatsuba_threshold() )
+		{// Full product and then n reduction steps
+		_int_limb_mul_vec( t, a, n, b, n );
+		t.resize( 2 * n + 1, 0 );
+		for( i = 0; i < n; ++i )
+			{
+			q = t[i] * ctx.minv % ILIMB_BASE;
+			for( c = 0, j = 0; j < n; ++j )
+				{
+				s = t[i+j] + q * m[j] + c;
+				c = s / ILIMB_BASE;
+				t[i+j] = (ilimb_t)( s - c * ILIMB_BASE );
+				}
+			for( j = i + n; c != 0; ++j )
+				{
+				s = t[j] + c;
+				c = s / ILIMB_BASE;
+				t[j] = (ilimb_t)( s - c * ILIMB_BASE );
+				}
+			}
+		if( _int_limb_compare( &t[n], n + 1, m, n ) >= 0 )
+			_int_limb_sub( &t[n], &t[n], n + 1, m, n );
+		std::copy( t.begin() + n, t.begin() + 2 * n, des );
+		return;
+		}
+
+	t.assign( n + 2, 0 );
+	for( i = 0; i < n; ++i )
+		{
+		for( c = 0, j = 0; j < n; ++j )
+			{
+			s = t[j] + (uint64_t)a[j] * b[i] + c;
+			c = s / ILIMB_BASE;
+			t[j] = (ilimb_t)( s - c * ILIMB_BASE );
+			}
+		s = t[n] + c;
+		c = s / ILIMB_BASE;
+		t[n] = (ilimb_t)( s - c * ILIMB_BASE );
+		t[n+1] = (ilimb_t)c;
+
+		q = t[0] * ctx.minv % ILIMB_BASE;
+		c = ( t[0] + q * m[0] ) / ILIMB_BASE;
+		for( j = 1; j < n; ++j )
+			{
+			s = t[j] + q * m[j] + c;
+			c = s / ILIMB_BASE;
+			t[j-1] = (ilimb_t)( s - c * ILIMB_BASE );
+			}
+		s = t[n] + c;
+		c = s / ILIMB_BASE;
+		t[n-1] = (ilimb_t)( s - c * ILIMB_BASE );
+		t[n] = (ilimb_t)( t[n+1] + c );
+		t[n+1] = 0;
+		}
+
+	if( _int_limb_compare( &t[0], n + 1, m, n ) >= 0 )
+		_int_limb_sub( &t[0], &t[0], n + 1, m, n );
+	std::copy( t.begin(), t.begin() + n, des );
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_modmul
+///	@return 	void	-
+///	@param   "ctx"	-	The Montgomery context
+///	@param   "des"	-	The result a*b*R^-1 mod m. Can be the same as a or b
+///	@param   "a"	-	First factor in Montgomery form
+///	@param   "b"	-	Second factor in Montgomery form
+///
+///	@todo
+///
+/// Description:
+///   Modular multiplication in Montgomery form for _int_limb_window_pow()
+//
+static void _int_limb_modmul( const _int_limb_montgomery& ctx, std::vector<ilimb_t>& des, const std::vector<ilimb_t>& a, const std::vector<ilimb_t>& b )
+	{
+	des.resize( ctx.m.size() );
+	_int_limb_mont_mul( ctx, &des[0], &a[0], &b[0] );
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_modmul
+///	@return 	void	-
+///	@param   "ctx"	-	The Barrett context of the modulus
+///	@param   "des"	-	The result a*b mod m. Can be the same as a or b
+///	@param   "a"	-	First factor less than m
+///	@param   "b"	-	Second factor less than m
+///
+///	@todo
+///
+/// Description:
+///   Modular multiplication with Barrett reduction for _int_limb_window_pow()
+//
+static void _int_limb_modmul( const _int_limb_barrett& ctx, std::vector<ilimb_t>& des, const std::vector<ilimb_t>& a, const std::vector<ilimb_t>& b )
+	{
+	std::vector<ilimb_t> t;
+
+	_int_limb_mul_vec( t, &a[0], a.size(), &b[0], b.size() );
+	_int_limb_barrett_divrem( ctx, NULL, &des, &t[0], t.size() );
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_window_pow
+///	@return 	void	-
+///	@param   "ctx"	-	The Montgomery or Barrett context of the modulus
+///	@param   "des"	-	The result x^e
+///	@param   "x"	-	The base reduced by the modulus
+///	@param   "one"	-	1 in the representation of ctx
+///	@param   "e"	-	The exponent as 32bit binary words with the least significant word first
+///	@param   "lo"	-	Only the bits of e from bit lo and up are used. The exponent is e>>lo
+///
+///	@todo
+///
+/// Description:
+///   Left to right sliding window exponentiation. The odd powers x,x^3,..,x^(2^k-1) are precomputed and each run of up to k bits
+///   that end with a one cost k squarings and a single multiplication. k grow with the number of bits in the exponent so
+///   a b bit exponent take about b squarings and b/(k+1) multiplications instead of the b/2 of the binary method
+//
+template <class _Ctx> static void _int_limb_window_pow( const _Ctx& ctx, std::vector<ilimb_t>& des, const std::vector<ilimb_t>& x, const std::vector<ilimb_t>& one, const std::vector<uint32_t>& e, size_t lo )
+	{
+	std::vector< std::vector<ilimb_t> > table;
+	std::vector<ilimb_t> x2;
+	size_t i, j, k, l, w, top;
+	bool first = true;
+
+	for( top = e.size() * 32; top > lo && ( ( e[(top-1)/32] >> ( ( top - 1 ) % 32 ) ) & 1 ) == 0; --top ) ;
+	if( top == lo )
+		{
+		des = one;
+		return;
+		}
+	k = top - lo <= 8 ? 1 : top - lo <= 24 ? 2 : top - lo <= 80 ? 3 : top - lo <= 240 ? 4 : top - lo <= 672 ? 5 : 6;
+	table.resize( (size_t)1 << ( k - 1 ) );
+	table[0] = x;
+	if( k > 1 )
+		{
+		_int_limb_modmul( ctx, x2, x, x );
+		for( j = 1; j < table.size(); ++j )
+			_int_limb_modmul( ctx, table[j], table[j-1], x2 );
+		}
+
+	for( i = top; i > lo; )
+		{
+		if( ( ( e[(i-1)/32] >> ( ( i - 1 ) % 32 ) ) & 1 ) == 0 )
+			{
+			_int_limb_modmul( ctx, des, des, des );
+			--i;
+			continue;
+			}
+		// The window is bits i-l..i-1 and end with a one
+		for( l = std::min( k, i - lo ); ( ( e[(i-l)/32] >> ( ( i - l ) % 32 ) ) & 1 ) == 0; --l ) ;
+		for( w = 0, j = i; j-- > i - l; )
+			w = 2 * w + ( ( e[j/32] >> ( j % 32 ) ) & 1 );
+		if( first )
+			des = table[w>>1];
+		else
+			{
+			for( j = 0; j < l; ++j )
+				_int_limb_modmul( ctx, des, des, des );
+			_int_limb_modmul( ctx, des, des, table[w>>1] );
+			}
+		first = false;
+		i -= l;
+		}
+	}
+
+static const size_t ILIMB_CONVERT_BLOCK = 32;	// Below this number of limbs or binary words the radix conversion use the quadratic method
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_binary_power
+///	@return 	const std::vector<ilimb_t>&	-	2^(32*2^k) as a limb vector. Valid until the next call with a larger k
+///	@param   "k"	-	The index into the table
+///
+///	@todo
+///
+/// Description:
+///   Persistent table of the powers 2^32, 2^64, 2^128,... used by the radix conversion. Each entry is the square of the previous
+//
+static const std::vector<ilimb_t>& _int_limb_binary_power( size_t k )
+	{
+	static std::vector< std::vector<ilimb_t> > powers;
+
+	if( powers.empty() )
+		{
+		std::vector<ilimb_t> p( 2 );
+		p[0] = (ilimb_t)( ( (uint64_t)1 << 32 ) % ILIMB_BASE );
+		p[1] = (ilimb_t)( ( (uint64_t)1 << 32 ) / ILIMB_BASE );
+		_int_limb_trim( p );
+		powers.push_back( p );
+		}
+	while( powers.size() <= k )
+		{
+		std::vector<ilimb_t> p;
+		const std::vector<ilimb_t>& b = powers.back();
+		_int_limb_mul_vec( p, &b[0], b.size(), &b[0], b.size() );
+		_int_limb_trim( p );
+		powers.push_back( p );
+		}
+
+	return powers[k];
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_to_binary
+///	@return 	void	-
+///	@param   "des"	-	The number as 32bit binary words with the least significant word first. Empty for zero
+///	@param   "a"	-	Limb vector
+///	@param   "na"	-	Number of limbs in a
+///
+///	@todo
+///
+/// Description:
+///   Convert a limb vector to binary. Below ILIMB_CONVERT_BLOCK limbs 16 bits are divided out at a time.
+///   Larger numbers are divided by a power 2^(32*2^k) from _int_limb_binary_power() of about the square root of a and
+///   the quotient and remainder are converted recursively, so the conversion scale like the division
+//
+static void _int_limb_to_binary( std::vector<uint32_t>& des, const ilimb_t *a, size_t na )
+	{
+	for( ; na > 0 && a[na-1] == 0; --na ) ;
+	des.clear();
+
+	if( na > ILIMB_CONVERT_BLOCK )
+		{
+		std::vector<ilimb_t> q, r;
+		std::vector<uint32_t> hi;
+		size_t k;
+
+		for( k = 0; 2 * _int_limb_binary_power( k + 1 ).size() <= na + 1; ++k ) ;
+		const std::vector<ilimb_t>& p = _int_limb_binary_power( k );
+		_int_limb_divrem( &q, &r, a, na, &p[0], p.size() );
+		_int_limb_to_binary( des, &r[0], r.size() );
+		des.resize( (size_t)1 << k, 0 );
+		_int_limb_to_binary( hi, &q[0], q.size() );
+		des.insert( des.end(), hi.begin(), hi.end() );
+		for( ; !des.empty() && des.back() == 0; des.pop_back() ) ;
+		return;
+		}
+
+	std::vector<ilimb_t> t( a, a + na );
+	size_t n = na;
+	for( int half = 0; ; half ^= 1 )
+		{
+		for( ; n > 0 && t[n-1] == 0; --n ) ;
+		if( n == 0 && half == 0 )
+			break;
+		uint32_t r = n > 0 ? _int_limb_div_short( &t[0], &t[0], n, 1 << 16 ) : 0;
+		if( half == 0 )
+			des.push_back( r );
+		else
+			des.back() |= r << 16;
+		}
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_from_binary
+///	@return 	void	-
+///	@param   "des"	-	The resulting limb vector. At least one limb
+///	@param   "w"	-	The number as 32bit binary words with the least significant word first
+///	@param   "nw"	-	Number of words in w
+///
+///	@todo
+///
+/// Description:
+///   Convert a binary number to a limb vector. Below ILIMB_CONVERT_BLOCK words the limb vector is multiplied by 2^16 and
+///   the next 16 bits added. Larger numbers are split at a power 2^(32*2^k) from _int_limb_binary_power() and the result
+///   is hi*2^(32*2^k)+lo, so the conversion scale like the multiplication
+//
+static void _int_limb_from_binary( std::vector<ilimb_t>& des, const uint32_t *w, size_t nw )
+	{
+	for( ; nw > 0 && w[nw-1] == 0; --nw ) ;
+
+	if( nw > ILIMB_CONVERT_BLOCK )
+		{
+		std::vector<ilimb_t> lo, hi;
+		size_t k;
+
+		for( k = 0; ( (size_t)2 << k ) < nw; ++k ) ;
+		_int_limb_from_binary( lo, w, (size_t)1 << k );
+		_int_limb_from_binary( hi, w + ( (size_t)1 << k ), nw - ( (size_t)1 << k ) );
+		const std::vector<ilimb_t>& p = _int_limb_binary_power( k );
+		_int_limb_mul_vec( des, &hi[0], hi.size(), &p[0], p.size() );
+		des.push_back( 0 );
+		_int_limb_add( &des[0], &des[0], des.size(), &lo[0], lo.size() );
+		_int_limb_trim( des );
+		return;
+		}
+
+	des.assign( 1, 0 );
+	for( size_t i = nw; i-- > 0; )
+		for( int h = 16; h >= 0; h -= 16 )
+			{
+			uint64_t c = ( w[i] >> h ) & 0xffff;
+			for( size_t j = 0; j < des.size(); ++j )
+				{
+				c += (uint64_t)des[j] << 16;
+				des[j] = (ilimb_t)( c % ILIMB_BASE );
+				c /= ILIMB_BASE;
+				}
+			if( c != 0 )
+				des.push_back( (ilimb_t)c );
+			}
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_mont_add
+///	@return 	void	-
+///	@param   "ctx"	-	The Montgomery context
+///	@param   "des"	-	The result a+b mod m. n limbs. Can be the same as a
+///	@param   "a"	-	First term. n limbs less than m
+///	@param   "b"	-	Second term. n limbs less than m
+///
+///	@todo
+///
+/// Description:
+///   Modular addition. The same for numbers in Montgomery form and ordinary residues
+//
+static void _int_limb_mont_add( const _int_limb_montgomery& ctx, ilimb_t *des, const ilimb_t *a, const ilimb_t *b )
+	{
+	const size_t n = ctx.m.size();
+
+	if( _int_limb_add( des, a, n, b, n ) != 0 || _int_limb_compare( des, n, &ctx.m[0], n ) >= 0 )
+		_int_limb_sub( des, des, n, &ctx.m[0], n );	// The borrow cancel the carry
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_mont_sub
+///	@return 	void	-
+///	@param   "ctx"	-	The Montgomery context
+///	@param   "des"	-	The result a-b mod m. n limbs. Can be the same as a
+///	@param   "a"	-	First term. n limbs less than m
+///	@param   "b"	-	Second term. n limbs less than m
+///
+///	@todo
+///
+/// Description:
+///   Modular subtraction. The same for numbers in Montgomery form and ordinary residues
+//
+static void _int_limb_mont_sub( const _int_limb_montgomery& ctx, ilimb_t *des, const ilimb_t *a, const ilimb_t *b )
+	{
+	const size_t n = ctx.m.size();
+
+	if( _int_limb_sub( des, a, n, b, n ) != 0 )
+		_int_limb_add( des, des, n, &ctx.m[0], n );	// The carry cancel the borrow
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_mont_half
+///	@return 	void	-
+///	@param   "ctx"	-	The Montgomery context
+///	@param   "a"	-	n limbs less than m. Replaced with a/2 mod m
+///
+///	@todo
+///
+/// Description:
+///   Modular halving for an odd modulus. An odd a is made even by adding m before the division with 2
+//
+static void _int_limb_mont_half( const _int_limb_montgomery& ctx, ilimb_t *a )
+	{
+	const size_t n = ctx.m.size();
+	std::vector<ilimb_t> t( a, a + n );
+
+	t.push_back( 0 );
+	if( t[0] & 1 )
+		t[n] = _int_limb_add( &t[0], &t[0], n, &ctx.m[0], n );
+	_int_limb_div_short( &t[0], &t[0], n + 1, 2 );
+	std::copy( t.begin(), t.begin() + n, a );
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_mont_small
+///	@return 	void	-
+///	@param   "ctx"	-	The Montgomery context
+///	@param   "des"	-	The small number v in Montgomery form. n limbs
+///	@param   "v"	-	A small signed number. |v| < ILIMB_BASE and less than the modulus
+///
+///	@todo
+///
+/// Description:
+///   Convert a small signed number to Montgomery form. A negative number become m-|v|R mod m
+//
+static void _int_limb_mont_small( const _int_limb_montgomery& ctx, ilimb_t *des, long v )
+	{
+	const size_t n = ctx.m.size();
+	std::vector<ilimb_t> t( n, 0 );
+
+	t[0] = (ilimb_t)( v < 0 ? -v : v );
+	_int_limb_mont_mul( ctx, des, &t[0], &ctx.r2[0] );
+	if( v < 0 )
+		_int_limb_sub( des, &ctx.m[0], n, des, n );
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_strong_probable_prime
+///	@return 	bool	-	false if the modulus of ctx is composite. true if it is a strong probable prime to the base
+///	@param   "ctx"	-	The Montgomery context of the odd number m to test
+///	@param   "base"	-	The base. 1 < base < m
+///
+///	@todo
+///
+/// Description:
+///   Miller-Rabin test. With m-1=d*2^s then m is a strong probable prime to the base if base^d=1 or base^(d*2^r)=-1 mod m
+///   for some 0<=r<s
+//
+static bool _int_limb_strong_probable_prime( const _int_limb_montgomery& ctx, ilimb_t base )
+	{
+	const size_t n = ctx.m.size();
+	std::vector<ilimb_t> x( n, 0 ), y, mone( n ), nm1( ctx.m );
+	std::vector<uint32_t> e;
+	size_t s, r;
+
+	nm1[0] -= 1;	// m is odd
+	_int_limb_to_binary( e, &nm1[0], n );
+	for( s = 0; ( ( e[s/32] >> ( s % 32 ) ) & 1 ) == 0; ++s ) ;
+	x[0] = base;
+	_int_limb_mont_mul( ctx, &x[0], &x[0], &ctx.r2[0] );
+	_int_limb_window_pow( ctx, y, x, ctx.one, e, s );
+	_int_limb_sub( &mone[0], &ctx.m[0], n, &ctx.one[0], n );	// -1 in Montgomery form
+	if( y == ctx.one || y == mone )
+		return true;
+	for( r = 1; r < s; ++r )
+		{
+		_int_limb_mont_mul( ctx, &y[0], &y[0], &y[0] );
+		if( y == mone )
+			return true;
+		if( y == ctx.one )
+			return false;
+		}
+
+	return false;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_strong_lucas
+///	@return 	bool	-	false if the modulus of ctx is composite. true if it is a strong Lucas probable prime
+///	@param   "ctx"	-	The Montgomery context of the odd number m to test
+///	@param   "d"	-	The discriminant D with Jacobi symbol (D/m)=-1
+///
+///	@todo
+///
+/// Description:
+///   Strong Lucas test with the Selfridge parameters P=1 and Q=(1-D)/4. With m+1=d*2^s then m is a strong Lucas probable prime
+///   if U(d)=0 or V(d*2^r)=0 mod m for some 0<=r<s. U, V and Q^k are found with the binary doubling formulas
+///   U(2k)=U(k)V(k), V(2k)=V(k)^2-2Q^k and U(k+1)=(PU(k)+V(k))/2, V(k+1)=(DU(k)+PV(k))/2
+//
+static bool _int_limb_strong_lucas( const _int_limb_montgomery& ctx, long d )
+	{
+	const size_t n = ctx.m.size();
+	std::vector<ilimb_t> u( ctx.one ), v( ctx.one ), qk( n ), q( n ), dm( n ), t( n ), np1( ctx.m ), zero( n, 0 );
+	std::vector<uint32_t> e;
+	const ilimb_t one = 1;
+	size_t s, i;
+
+	np1.push_back( 0 );
+	np1[n] = _int_limb_add( &np1[0], &np1[0], n, &one, 1 );
+	_int_limb_to_binary( e, &np1[0], n + 1 );
+	for( s = 0; ( ( e[s/32] >> ( s % 32 ) ) & 1 ) == 0; ++s ) ;
+	for( i = e.size() * 32 - 1; ( ( e[i/32] >> ( i % 32 ) ) & 1 ) == 0; --i ) ;
+	_int_limb_mont_small( ctx, &q[0], ( 1 - d ) / 4 );
+	_int_limb_mont_small( ctx, &dm[0], d );
+	qk = q;
+
+	// U(1)=1, V(1)=P=1. Walk down the bits of d below the top bit
+	while( i-- > s )
+		{
+		_int_limb_mont_mul( ctx, &u[0], &u[0], &v[0] );
+		_int_limb_mont_mul( ctx, &v[0], &v[0], &v[0] );
+		_int_limb_mont_sub( ctx, &v[0], &v[0], &qk[0] );
+		_int_limb_mont_sub( ctx, &v[0], &v[0], &qk[0] );
+		_int_limb_mont_mul( ctx, &qk[0], &qk[0], &qk[0] );
+		if( ( e[i/32] >> ( i % 32 ) ) & 1 )
+			{
+			_int_limb_mont_mul( ctx, &t[0], &dm[0], &u[0] );
+			_int_limb_mont_add( ctx, &u[0], &u[0], &v[0] );
+			_int_limb_mont_add( ctx, &v[0], &v[0], &t[0] );
+			_int_limb_mont_half( ctx, &u[0] );
+			_int_limb_mont_half( ctx, &v[0] );
+			_int_limb_mont_mul( ctx, &qk[0], &qk[0], &q[0] );
+			}
+		}
+
+	if( u == zero || v == zero )
+		return true;
+	for( i = 1; i < s; ++i )
+		{
+		_int_limb_mont_mul( ctx, &v[0], &v[0], &v[0] );
+		_int_limb_mont_sub( ctx, &v[0], &v[0], &qk[0] );
+		_int_limb_mont_sub( ctx, &v[0], &v[0], &qk[0] );
+		if( v == zero )
+			return true;
+		_int_limb_mont_mul( ctx, &qk[0], &qk[0], &qk[0] );
+		}
+
+	return false;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_limb_jacobi
+///	@return 	int	-	The Jacobi symbol (d/m) -1, 0 or 1
+///	@param   "d"	-	A small signed number
+///	@param   "m"	-	The odd limb vector
+///	@param   "nm"	-	Number of limbs in m
+///
+///	@todo
+///
+/// Description:
+///   Jacobi symbol of a small number over a large odd number. Quadratic reciprocity turns it into (m mod |d| / |d|)
+///   that only need one short division of m
+//
+static int _int_limb_jacobi( long d, const ilimb_t *m, size_t nm )
+	{
+	uint64_t a = d < 0 ? -d : d, b, m4 = m[0] % 4;
+	int j = 1;
+
+	if( ( a & 1 ) == 0 )
+		return 0;		// Only odd d is used
+	if( d < 0 && m4 == 3 )
+		j = -j;			// (-1/m)
+	if( a % 4 == 3 && m4 == 3 )
+		j = -j;			// Reciprocity (a/m)=(m/a)
+	b = a;
+	a = _int_limb_div_short( NULL, m, nm, (unsigned int)b );
+	while( a != 0 )
+		{
+		for( ; ( a & 1 ) == 0; a >>= 1 )
+			if( b % 8 == 3 || b % 8 == 5 )
+				j = -j;
+		std::swap( a, b );
+		if( a % 4 == 3 && b % 4 == 3 )
+			j = -j;
+		a %= b;
+		}
+
+	return b == 1 ? j : 0;
+	}
+
+
+///	@author Henrik Vestermark (hve@hvks.com)
+///	@date  1/14/2005
+///	@brief 		std::string _int_precision_uadd_short
+///	@return 		std::string - 	the result of the add
+///	@param      "src1"	-	Source string to add short number
+///	@param      "d"	   -	Number to add.
+///
+///	@todo
+///
+/// Description:
+///   Short Add: The digit d [0..RADIX] is added to the unsigned decimal string
+///   Optimized 0 add or early out add is implemented
+///   Please note that uadd_short will throw an exception if d is larger than the
+///   RADIX of the internal representation. e.g. is RADIX is BASE_10 then d can
+///   be in the range of 0..10. If base is BASE_2 the d can only be in the range
+///   from 0..2
+//
+std::string _int_precision_uadd_short( std::string *src1, unsigned int d )
+   {
+   unsigned short ireg;
+   std::string::reverse_iterator r1_pos;
+   std::string::reverse_iterator rd_pos;
+   std::string des1;
+
+   if( d > (unsigned)RADIX )
+      { throw int_precision::out_of_range();      }
+
+   if( d == 0 )   // Zero add
+      return *src1;
+
+   ireg = (unsigned short)( RADIX * d );
+   des1 = *src1;
+   rd_pos = des1.rbegin();
+   r1_pos = src1->rbegin();
+
+   for(; r1_pos != src1->rend(); ++r1_pos, ++rd_pos )
+      {
+      ireg = (unsigned short)( IDIGIT( *r1_pos ) + ICARRY( ireg ) );
+      *rd_pos = ICHARACTER( (unsigned char)ISINGLE( ireg ) );
+      if( ICARRY( ireg ) == 0 ) // Early out add
+         break;
+      }
+
+   if( ICARRY( ireg ) != 0 )  // Insert the carry in the front of the number
+      des1.insert( (std::string::size_type)0, 1, ICHARACTER( (unsigned char)ICARRY( ireg ) ) );
+
+   _int_precision_strip_leading_zeros( &des1 );
+
+   return des1;
+   }
+
+
+///	@author Henrik Vestermark (hve@hvks.com)
+///	@date  1/14/2005
+///	@brief 	std::string _int_precision_uadd
+///	@return 	std::string	-	the result of adding src1 and src2
+///	@param   "src1"	-	First unsigned source argument
+///	@param   "src2"	-	Second unsigned source argument
+///
+///	@todo
+///
+/// Description:
+///   Add two unsigned decimal strings
+///   Optimized: Used early out add
+//
+std::string _int_precision_uadd( std::string *src1, std::string *src2 )
+   {
+   unsigned short ireg = 0;
+   std::string des1;
+   std::string::reverse_iterator r_pos, r_end;
+   std::string::reverse_iterator rd_pos;
+
+   if( src1->length() >= src2->length() )
+      {
+      des1 = *src1;
+      r_pos = src2->rbegin();
+      r_end = src2->rend();
+      }
+   else
+      {
+      des1 = *src2;
+      r_pos = src1->rbegin();
+      r_end = src1->rend();
+      }
+   rd_pos = des1.rbegin();
+
+   for( ; r_pos != r_end; )
+      { // Adding element by element for the two numbers
+      ireg = (unsigned char)( IDIGIT( *r_pos ) + IDIGIT( *rd_pos ) + ICARRY( ireg ) );
+      *rd_pos = ICHARACTER( (unsigned char)ISINGLE( ireg ) );
       ++r_pos;
       ++rd_pos;
       }
@@ -591,8 +3100,7 @@ std::string _int_precision_uadd( std::string *src1, std::string *src2 )
 std::string _int_precision_usub_short( int *result, std::string *src1, unsigned int d )
    {
    unsigned short ireg = RADIX;
-   std::string::reverse_iterator r1_pos;
-   std::string::iterator d_pos;
+   std::string::reverse_iterator rd_pos;
    std::string des1;
 
    if( d > (unsigned)RADIX )
@@ -604,17 +3112,15 @@ std::string _int_precision_usub_short( int *result, std::string *src1, unsigned
       return *src1;
       }
 
-   des1.erase();
-   des1.reserve( src1->capacity() );  // Reserver space to avoid time consuming reallocation
-   d_pos = des1.begin();
-   r1_pos = src1->rbegin();
+   des1 = *src1;
+   rd_pos = des1.rbegin();
 
-   ireg = (unsigned short)( RADIX - 1 + IDIGIT( *r1_pos ) - d + ICARRY( ireg ) );
-   d_pos = des1.insert( d_pos, ICHARACTER( (unsigned char)ISINGLE( ireg ) ) );
-   for( ++r1_pos; ICARRY( ireg ) && r1_pos != src1->rend(); ++r1_pos )
-      {
-      ireg = (unsigned short)( RADIX - 1 + IDIGIT( *r1_pos ) + ICARRY( ireg ) );
-      d_pos = des1.insert( d_pos, ICHARACTER( (unsigned char)ISINGLE( ireg ) ) );
+   ireg = (unsigned short)( RADIX - 1 + IDIGIT( *rd_pos ) - d + ICARRY( ireg ) );
+   *rd_pos = ICHARACTER( (unsigned char)ISINGLE( ireg ) );
+   for( ++rd_pos; ICARRY( ireg ) == 0 && rd_pos != des1.rend(); ++rd_pos )
+      { // Propagate the borrow. Early out when there is no more borrow
+      ireg = (unsigned short)( RADIX - 1 + IDIGIT( *rd_pos ) + ICARRY( ireg ) );
+      *rd_pos = ICHARACTER( (unsigned char)ISINGLE( ireg ) );
       }
 
    _int_precision_strip_leading_zeros( &des1 );
@@ -645,6 +3151,38 @@ std::string _int_precision_usub( int *result, std::string *src1, std::string *sr
    std::string::iterator d_pos;
    std::string des1;
 
+#ifdef _INT_PRECISION_LIMB_KERNELS
+   if( src1->length() >= ILIMB_THRESHOLD || src2->length() >= ILIMB_THRESHOLD )
+      {// Subtract a whole limb at a time
+      std::vector<ilimb_t> a, b;
+
+      _int_precision_pack_limbs( a, src1 );
+      _int_precision_pack_limbs( b, src2 );
+      if( _int_limb_compare( &a[0], a.size(), &b[0], b.size() ) >= 0 )
+         {
+         if( a.size() < b.size() )
+            a.resize( b.size(), 0 );
+         _int_limb_sub( &a[0], &a[0], a.size(), &b[0], b.size() );
+         *result = 0;
+         return _int_precision_unpack_limbs( &a[0], a.size() );
+         }
+      else
+         {// Wrap around. Return the RADIX complement RADIX^digits-(src2-src1) the same way as the digit loop below
+         size_t digits = src1->length() > src2->length() ? src1->length() : src2->length();
+         std::vector<ilimb_t> c( digits / ILIMB_DIGITS + 1, 0 );
+
+         if( b.size() < a.size() )
+            b.resize( a.size(), 0 );
+         _int_limb_sub( &b[0], &b[0], b.size(), &a[0], a.size() );
+         for( c.back() = 1; digits % ILIMB_DIGITS != 0; --digits )
+            c.back() *= RADIX;
+         _int_limb_sub( &c[0], &c[0], c.size(), &b[0], b.size() );
+         *result = -1;
+         return _int_precision_unpack_limbs( &c[0], c.size() );
+         }
+      }
+#endif
+
    des1.erase();
    if( src1->length() > src2->length() )
       des1.reserve( src1->capacity() );  // Reserver space to avoid time consuming reallocation
@@ -721,19 +3259,28 @@ std::string _int_precision_umul_short( std::string *src1, unsigned int d )
       return des1;
       }
 
-   des1.erase();
-   des1.reserve( src1->capacity() );  // Reserver space to avoid time consuming reallocation
-   d_pos = des1.begin();
+#ifdef _INT_PRECISION_LIMB_KERNELS
+   if( src1->length() >= ILIMB_THRESHOLD )
+      {// Multiply a whole limb at a time
+      std::vector<ilimb_t> a;
+
+      _int_precision_pack_limbs( a, src1 );
+      a.push_back( 0 );
+      a.back() = _int_limb_mul_short( &a[0], &a[0], a.size() - 1, d );
+      return _int_precision_unpack_limbs( &a[0], a.size() );
+      }
+#endif
+
+   des1.resize( src1->length() + 1 );  // Room for the carry. Fill it from the back to avoid inserting in the front
+   d_pos = des1.end();
    r1_pos = src1->rbegin();
 
    for(; r1_pos != src1->rend(); ++r1_pos )
       {
       ireg = (unsigned short)( IDIGIT( *r1_pos ) * d + ICARRY( ireg ) );
-      d_pos = des1.insert( d_pos, ICHARACTER( (unsigned char)ISINGLE( ireg ) ) );
+      *--d_pos = ICHARACTER( (unsigned char)ISINGLE( ireg ) );
       }
-
-   if( ICARRY( ireg ) != 0 )
-      d_pos = des1.insert( d_pos, ICHARACTER( (unsigned char)ICARRY( ireg ) ) );
+   *--d_pos = ICHARACTER( (unsigned char)ICARRY( ireg ) );
 
    _int_precision_strip_leading_zeros( &des1 );
 
@@ -752,12 +3299,26 @@ std::string _int_precision_umul_short( std::string *src1, unsigned int d )
 ///
 /// Description:
 ///   Multiply two unsigned decimal strings.
-///	Not used anymore since the complexity is o(n^2)
+///	The complexity is o(n^2). With the limb kernels the multiplication is done ILIMB_DIGITS digits at a time
+///   using Karatsuba and Toom-Cook 3 way above the precision_ctrl thresholds which makes it faster than the FFT for small and medium sized operands
 //
 std::string _int_precision_umul( std::string *src1, std::string *src2 )
    {
+   std::string des1;
+
+#ifdef _INT_PRECISION_LIMB_KERNELS
+      {// Multiply a whole limb at a time
+      std::vector<ilimb_t> a, b, c;
+
+      _int_precision_pack_limbs( a, src1 );
+      _int_precision_pack_limbs( b, src2 );
+      c.resize( a.size() + b.size() );
+      _int_limb_toom3_mul( &c[0], &a[0], a.size(), &b[0], b.size() );
+      des1 = _int_precision_unpack_limbs( &c[0], c.size() );
+      }
+#else
    int disp;
-   std::string des1, tmp;
+   std::string tmp;
    std::string::reverse_iterator r_pos2;
 
    r_pos2 = src2->rbegin();
@@ -773,6 +3334,7 @@ std::string _int_precision_umul( std::string *src1, std::string *src2 )
       }
 
    _int_precision_strip_leading_zeros( &des1 );
+#endif
 
    return des1;
    }
@@ -809,18 +3371,13 @@ std::string _int_precision_umul64(std::string *src1, std::string *src2)
 ///
 /// Description:
 ///   Multiply two unsigned decimal strings, using the karatsuba method
-///	  Karatsuba is faster than umul_fourier with operands up to	 19-20 decimal digits whereafter _umul_fourier is faster
+///   The operands are packed into limbs and multiplied with _int_limb_karatsuba_mul() using a single preallocated scratch arena
 ///   Notice when operands can fit into a 64bit integer we switch to native multiplications.
 //
 string _int_precision_karatsuba_umul(const std::string *lhs, const std::string *rhs)
 	{
-	std::string result, z0, z1, z2, z3;
-	std::string lhs0, lhs1, rhs0, rhs1;
-	int wrap;
-	unsigned int half_length, length, l_length = lhs->size(), r_length = rhs->size(), tot_len;
-	length = l_length;
-	if (length < r_length)
-		length = r_length;
+	std::string result;
+	unsigned int l_length = lhs->size(), r_length = rhs->size(), tot_len;
 	tot_len = l_length + r_length;
 	if (RADIX == BASE_10 && tot_len <= 18 || RADIX == BASE_256 && tot_len <= 8 || RADIX == BASE_8 && tot_len <= 20 || RADIX == BASE_2 && tot_len <= 64)  // If max digits in lhs & rhs less than fit into a 32 bit integer then do it the binary way
 		{
@@ -828,49 +3385,14 @@ string _int_precision_karatsuba_umul(const std::string *lhs, const std::string *
 		return result;
 		}
 
-	// Splitting
-	half_length = length >> 1;
-	if (l_length <= half_length)
-		{
-		lhs0.insert(0, 1, ICHARACTER(0)); lhs1 = lhs->substr();
-		}
-	else if (l_length < length)
-		{
-		int tmp_length = half_length - (length - l_length);
-		if (tmp_length == 0) lhs0.insert(0, 1, ICHARACTER(0)); else lhs0 = lhs->substr(0, tmp_length); lhs1 = lhs->substr(tmp_length);
-		}
-	else
-		{
-		lhs0 = lhs->substr(0, half_length); lhs1 = lhs->substr(half_length);
-		}
-	if (r_length <= half_length)
-		{
-		rhs0.insert(0, 1, ICHARACTER(0)); rhs1 = rhs->substr();
-		}
-	else if (r_length < length)
-		{
-		int tmp_length = half_length - (length - r_length);
-		if (tmp_length == 0) rhs0.insert(0, 1, ICHARACTER(0)); else rhs0 = rhs->substr(0, tmp_length); rhs1 = rhs->substr(tmp_length);
-		}
-	else
-		{
-		rhs0 = rhs->substr(0, half_length); rhs1 = rhs->substr(half_length);
-		}
-
-	// Evaluation
-	z0 = _int_precision_karatsuba_umul(&lhs0, &rhs0);
-	z1 = _int_precision_karatsuba_umul(&lhs1, &rhs1);
-	auto t0 = _int_precision_uadd(&lhs0, &lhs1);
-	auto t1 = _int_precision_uadd(&rhs0, &rhs1);
-	auto t2 = _int_precision_uadd(&z0, &z1);
-	z2 = _int_precision_karatsuba_umul(&t0, &t1);
-	z3 = _int_precision_usub(&wrap, &z2, &t2);
-
-	// Recomposition
-	z0.append(2 * (length - half_length), ICHARACTER(0));
-	z3.append(length - half_length, ICHARACTER(0));
-  auto t3 = _int_precision_uadd(&z0, &z1);
-	result = _int_precision_uadd(&t3, &z3);
+	// Pack the operands and allocate the result and the scratch arena once. The recursion itself does not allocate
+	std::vector<ilimb_t> a, b, c, scratch;
+	_int_precision_pack_limbs( a, lhs );
+	_int_precision_pack_limbs( b, rhs );
+	c.resize( a.size() + b.size() );
+	scratch.resize( _int_limb_karatsuba_scratch( a.size() > b.size() ? a.size() : b.size() ) + 1 );
+	_int_limb_karatsuba_mul( &c[0], &a[0], a.size(), &b[0], b.size(), &scratch[0] );
+	result = _int_precision_unpack_limbs( &c[0], c.size() );
 	return result;
 	}
 
@@ -991,6 +3513,244 @@ std::string _int_precision_umul_fourier( std::string *src1, std::string *src2 )
    return des1;
    }
 
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//
+//    Number theoretic transform
+//
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//
+// Exact multiplication of very large integers. The operands are packed into limbs and the linear convolution
+// is done modulo three NTT friendly primes p=c*2^k+1 all less than 2^30. The result for each coefficient is
+// recombined using the Chinese Remainder Theorem (Garner's method). Since p1*p2*p3 > 2^85 the coefficients can
+// be recovered exactly as long as min(na,nb)*(ILIMB_BASE-1)^2 < p1*p2*p3. Unlike the double precision FFT there
+// is no rounding error regardless of the operand size.
+// All modular multiplications in the transform are done using 32bit Montgomery multiplication which only
+// requires a 32x32->64 bit multiplication and is therefore also fast on 32bit targets.
+//    _int_ntt_init       -- Setup the Montgomery constants for a NTT prime
+//    _int_ntt_redc       -- Montgomery reduction
+//    _int_ntt_pow        -- Montgomery power
+//    _int_ntt            -- Forward or inverse number theoretic transform
+//
+
+struct _int_ntt_prime {
+	uint32_t p;		// The prime c*2^k+1
+	uint32_t g;		// A primitive root of p
+	uint32_t pinv;	// -p^-1 mod 2^32
+	uint32_t r2;	// 2^64 mod p
+	};
+
+static const uint32_t NTT_P1 = 998244353;	// 119*2^23+1
+static const uint32_t NTT_P2 = 469762049;	// 7*2^26+1
+static const uint32_t NTT_P3 = 167772161;	// 5*2^25+1
+static const unsigned int NTT_MAX_LOG2 = 23;	// Largest transform size supported by all three primes
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_ntt_init
+///	@return 	_int_ntt_prime	-	The Montgomery constants for the prime
+///	@param   "p"	-	The prime
+///	@param   "g"	-	A primitive root of p
+///
+///	@todo
+///
+/// Description:
+///   Calculate the Montgomery constants -p^-1 mod 2^32 and 2^64 mod p for the prime p
+//
+static _int_ntt_prime _int_ntt_init( uint32_t p, uint32_t g )
+	{
+	_int_ntt_prime m;
+	uint32_t inv = p;	// Newton iteration for p^-1 mod 2^32. Correct to 3 bits for odd p and doubles each iteration
+
+	for( int i = 0; i < 4; ++i )
+		inv *= 2 - p * inv;
+	m.p = p;
+	m.g = g;
+	m.pinv = (uint32_t)0 - inv;
+	m.r2 = (uint32_t)( ( (uint64_t)1 << 32 ) % p );
+	m.r2 = (uint32_t)( (uint64_t)m.r2 * m.r2 % p );
+	return m;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_ntt_redc
+///	@return 	uint32_t	-	t*2^-32 mod p
+///	@param   "t"	-	The number to reduce. t < p*2^32
+///	@param   "m"	-	The Montgomery constants
+///
+///	@todo
+///
+/// Description:
+///   Montgomery reduction. Multiplying two numbers in Montgomery form a*b is done as _int_ntt_redc(a*b)
+//
+static inline uint32_t _int_ntt_redc( uint64_t t, const _int_ntt_prime& m )
+	{
+	uint32_t q = (uint32_t)t * m.pinv;
+	uint32_t u = (uint32_t)( ( t + (uint64_t)q * m.p ) >> 32 );
+	return u >= m.p ? u - m.p : u;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_ntt_pow
+///	@return 	uint32_t	-	a^e in Montgomery form
+///	@param   "a"	-	The base in Montgomery form
+///	@param   "e"	-	The exponent
+///	@param   "m"	-	The Montgomery constants
+///
+///	@todo
+///
+/// Description:
+///   Calculate a^e mod p using binary exponentiation
+//
+static uint32_t _int_ntt_pow( uint32_t a, uint32_t e, const _int_ntt_prime& m )
+	{
+	uint32_t r = _int_ntt_redc( m.r2, m );	// 1 in Montgomery form
+
+	for( ; e != 0; e >>= 1, a = _int_ntt_redc( (uint64_t)a * a, m ) )
+		if( e & 1 )
+			r = _int_ntt_redc( (uint64_t)r * a, m );
+	return r;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_ntt
+///	@return 	void	-
+///	@param   "a"	-	The data in Montgomery form
+///	@param   "roots"	-	The table of roots. roots[h+j]=w^j where w is the primitive 2h'th root of unity
+///	@param   "n"	-	Number of elements in a. Must be a power of 2
+///	@param   "isign"	-	1 for the forward transform, -1 for the inverse transform (without the 1/n scaling)
+///	@param   "m"	-	The Montgomery constants
+///
+///	@todo
+///
+/// Description:
+///   Iterative radix 2 decimation in time number theoretic transform
+///   The inverse transform is done as a forward transform followed by reversing the elements a[1]..a[n-1]
+//
+static void _int_ntt( uint32_t *a, const uint32_t *roots, unsigned int n, int isign, const _int_ntt_prime& m )
+	{
+	unsigned int i, j, k, h;
+
+	for( i = 1, j = 0; i < n; ++i )
+		{// Bit reversal permutation
+		unsigned int bit = n >> 1;
+		for( ; j & bit; bit >>= 1 )
+			j ^= bit;
+		j ^= bit;
+		if( i < j )
+			std::swap( a[i], a[j] );
+		}
+
+	for( h = 1; h < n; h <<= 1 )
+		for( i = 0; i < n; i += 2 * h )
+			for( k = 0; k < h; ++k )
+				{
+				uint32_t u = a[i+k];
+				uint32_t v = _int_ntt_redc( (uint64_t)a[i+k+h] * roots[h+k], m );
+				a[i+k] = u + v >= m.p ? u + v - m.p : u + v;
+				a[i+k+h] = u >= v ? u - v : u + m.p - v;
+				}
+
+	if( isign < 0 )
+		std::reverse( a + 1, a + n );
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	std::string _int_precision_umul_ntt
+///	@return 	std::string	-	the result of multplying src1 and src2
+///	@param   "src1"	-	First unsigned source argument
+///	@param   "src2"	-	Second unsigned source argument
+///
+///	@todo
+///
+/// Description:
+///   Multiply two unsigned decimal strings
+///   Optimized: Use a three prime number theoretic transform on the limbs of src1 and src2. The result is exact
+///   If the operands exceed the size the three primes can handle the multiplication is done using _int_precision_umul_fourier()
+//
+std::string _int_precision_umul_ntt( std::string *src1, std::string *src2 )
+	{
+	static const _int_ntt_prime primes[3] = { _int_ntt_init( NTT_P1, 3 ), _int_ntt_init( NTT_P2, 3 ), _int_ntt_init( NTT_P3, 3 ) };
+	std::vector<ilimb_t> a, b;
+	std::vector<uint32_t> fa, fb, roots, res[3];
+	unsigned int n, i, h;
+	int k;
+	bool square = src1 == src2 || *src1 == *src2;
+
+	_int_precision_pack_limbs( a, src1 );
+	_int_precision_pack_limbs( b, src2 );
+	for( n = 1; n < a.size() + b.size() - 1; n <<= 1 ) ;
+	if( n > ( 1u << NTT_MAX_LOG2 ) || (double)( a.size() < b.size() ? a.size() : b.size() ) * (double)( ILIMB_BASE - 1 ) * (double)( ILIMB_BASE - 1 ) > (double)NTT_P1 * (double)NTT_P2 * (double)NTT_P3 / 2 )
+		return _int_precision_umul_fourier( src1, src2 );	// Out of range for exact recombination
+
+	fa.resize( n );
+	fb.resize( n );
+	roots.resize( n );
+	for( k = 0; k < 3; ++k )
+		{
+		const _int_ntt_prime& m = primes[k];
+		uint32_t one = _int_ntt_redc( m.r2, m ), g = _int_ntt_redc( (uint64_t)m.g * m.r2, m );
+		uint32_t ninv = _int_ntt_pow( _int_ntt_redc( (uint64_t)n * m.r2, m ), m.p - 2, m );	// 1/n in Montgomery form
+
+		for( h = 1; h < n; h <<= 1 )
+			{// roots[h+j] = w^j, where w is the primitive 2h'th root of unity
+			uint32_t w = _int_ntt_pow( g, ( m.p - 1 ) / ( 2 * h ), m );
+			roots[h] = one;
+			for( i = 1; i < h; ++i )
+				roots[h+i] = _int_ntt_redc( (uint64_t)roots[h+i-1] * w, m );
+			}
+
+		for( i = 0; i < n; ++i )
+			fa[i] = i < a.size() ? _int_ntt_redc( (uint64_t)a[i] * m.r2, m ) : 0;
+		_int_ntt( &fa[0], &roots[0], n, 1, m );
+		if( square )
+			fb = fa;
+		else
+			{
+			for( i = 0; i < n; ++i )
+				fb[i] = i < b.size() ? _int_ntt_redc( (uint64_t)b[i] * m.r2, m ) : 0;
+			_int_ntt( &fb[0], &roots[0], n, 1, m );
+			}
+		for( i = 0; i < n; ++i )
+			fa[i] = _int_ntt_redc( (uint64_t)_int_ntt_redc( (uint64_t)fa[i] * fb[i], m ) * ninv, m );
+		_int_ntt( &fa[0], &roots[0], n, -1, m );
+
+		res[k].resize( a.size() + b.size() - 1 );
+		for( i = 0; i < res[k].size(); ++i )
+			res[k][i] = _int_ntt_redc( fa[i], m );	// Convert back from Montgomery form
+		}
+
+	// Garner's recombination x = r1 + p1*t2 + p1*p2*t3 followed by carry propagation in base ILIMB_BASE
+	const uint64_t p12 = (uint64_t)NTT_P1 * NTT_P2;
+	const uint64_t p12_hi = p12 / ILIMB_BASE, p12_lo = p12 % ILIMB_BASE;
+	const uint32_t inv_p1_p2 = _int_ntt_redc( _int_ntt_pow( _int_ntt_redc( (uint64_t)( NTT_P1 % NTT_P2 ) * primes[1].r2, primes[1] ), NTT_P2 - 2, primes[1] ), primes[1] );		// p1^-1 mod p2
+	const uint32_t inv_p12_p3 = _int_ntt_redc( _int_ntt_pow( _int_ntt_redc( p12 % NTT_P3 * primes[2].r2, primes[2] ), NTT_P3 - 2, primes[2] ), primes[2] );	// (p1*p2)^-1 mod p3
+	std::vector<ilimb_t> c( a.size() + b.size() );
+	uint64_t carry = 0;
+
+	for( i = 0; i < res[0].size(); ++i )
+		{
+		uint32_t r1 = res[0][i], r2 = res[1][i], r3 = res[2][i];
+		uint64_t t2 = (uint64_t)( r2 + NTT_P2 - r1 % NTT_P2 ) * inv_p1_p2 % NTT_P2;
+		uint64_t x12 = r1 + NTT_P1 * t2;
+		uint64_t t3 = (uint64_t)( r3 + NTT_P3 - (uint32_t)( x12 % NTT_P3 ) ) * inv_p12_p3 % NTT_P3;
+		uint64_t lo = x12 + t3 * p12_lo + carry;
+
+		c[i] = (ilimb_t)( lo % ILIMB_BASE );
+		carry = lo / ILIMB_BASE + t3 * p12_hi;
+		}
+	c[i] = (ilimb_t)carry;
+
+	return _int_precision_unpack_limbs( &c[0], c.size() );
+	}
+
 // Short Division: The digit d [1..RADIX] is divide up into the unsigned decimal string
 //
 ///	@author Henrik Vestermark (hve@hvks.com)
@@ -1039,6 +3799,17 @@ std::string _int_precision_udiv_short( unsigned int *remaind, std::string *src1,
 		return des1;
 		}
 
+#ifdef _INT_PRECISION_LIMB_KERNELS
+	if( src1->length() >= ILIMB_THRESHOLD )
+		{// Divide a whole limb at a time
+		std::vector<ilimb_t> a;
+
+		_int_precision_pack_limbs( a, src1 );
+		*remaind = _int_limb_div_short( &a[0], &a[0], a.size(), d );
+		return _int_precision_unpack_limbs( &a[0], a.size() );
+		}
+#endif
+
 	//des1.erase();
 	des1.reserve( src1->capacity() );  // Reserver space to avoid time consuming reallocation
 	s1_pos = src1->begin();
@@ -1088,6 +3859,8 @@ std::string _int_precision_udiv64(std::string *src1, std::string *src2)
 ///
 /// Description:
 ///   Divide two unsigned decimal strings
+///   With _INT_PRECISION_LIMB_KERNELS the division is done by _int_limb_divrem() which use long division a limb at a time
+///   or Newton division for large operands.
 ///   Optimized: Used early out add and multiplication w. zero
 //
 std::string _int_precision_udiv( std::string *src1, std::string *src2 )
@@ -1100,6 +3873,19 @@ std::string _int_precision_udiv( std::string *src1, std::string *src2 )
    if( src2->length() == 1 ) // Make short div
       return _int_precision_udiv_short( (unsigned int *)&wrap, &divisor, IDIGIT( (*src2)[0] ) );
 
+#ifdef _INT_PRECISION_LIMB_KERNELS
+      {// Long division a limb at a time or Newton division for large operands
+      std::vector<ilimb_t> a, b, q;
+
+      _int_precision_pack_limbs( a, src1 );
+      _int_precision_pack_limbs( b, src2 );
+      if( _int_limb_compare( &b[0], b.size(), NULL, 0 ) == 0 )
+         { throw int_precision::divide_by_zero(); }
+      _int_limb_divrem( &q, NULL, &a[0], a.size(), &b[0], b.size() );
+      return _int_precision_unpack_limbs( &q[0], q.size() );
+      }
+#endif
+
    plusdigit = (int)divisor.length() - (int)src2->length();
    for(  ;plusdigit > 1; )
       {
@@ -1206,6 +3992,17 @@ std::string _int_precision_urem_short(std::string *src1, unsigned int d)
 			}
 		}
 
+#ifdef _INT_PRECISION_LIMB_KERNELS
+	if( src1->length() >= ILIMB_THRESHOLD )
+		{// Divide a whole limb at a time
+		std::vector<ilimb_t> a;
+
+		_int_precision_pack_limbs( a, src1 );
+		des1 = ICHARACTER( (unsigned char)_int_limb_div_short( NULL, &a[0], a.size(), d ) );
+		return des1;
+		}
+#endif
+
 	ir = 0;
 	for (; s1_pos != src1->end(); ++s1_pos)
 		{
@@ -1250,6 +4047,7 @@ std::string _int_precision_urem64(std::string *src1, std::string *src2)
 ///
 /// Description:
 ///   Find the remainder when divide two unsigned decimal strings
+///   With _INT_PRECISION_LIMB_KERNELS the remainder is found by _int_limb_divrem()
 ///   Optimized: Used early out add and multiplication w. zero
 //
 std::string _int_precision_urem( std::string *src1, std::string *src2 )
@@ -1267,6 +4065,19 @@ std::string _int_precision_urem( std::string *src1, std::string *src2 )
       return des;
       }
 
+#ifdef _INT_PRECISION_LIMB_KERNELS
+      {// Long division a limb at a time or Newton division for large operands
+      std::vector<ilimb_t> a, b, r;
+
+      _int_precision_pack_limbs( a, src1 );
+      _int_precision_pack_limbs( b, src2 );
+      if( _int_limb_compare( &b[0], b.size(), NULL, 0 ) == 0 )
+         { throw int_precision::divide_by_zero(); }
+      _int_limb_divrem( NULL, &r, &a[0], a.size(), &b[0], b.size() );
+      return _int_precision_unpack_limbs( &r[0], r.size() );
+      }
+#endif
+
    plusdigit = (int)src1->length() - (int)src2->length();
    for( ; plusdigit > 1; )
       {
@@ -1658,6 +4469,50 @@ static std::string build_i_number( std::string &number, int digit, int base )
     return number;
     }
 
+#ifdef _INT_PRECISION_LIMB_KERNELS
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief  Convert a string of binary, octal or hexadecimal digits
+///	@return	 std::string	- The integer precision string
+///	@param   "s"			- The string
+///	@param   "first"		- Index of the first digit in s. The digits are already validated
+/// @param   "bits"			- Number of bits per digit. 1, 3 or 4
+///
+///	@todo
+///
+/// Description:
+///   The digits are packed into 32bit binary words starting from the least significant digit and the words are converted
+///   to limbs with _int_limb_from_binary() which scale like the multiplication instead of a multiplication per digit
+//
+static std::string _int_precision_atoi_binary( const std::string& s, size_t first, int bits )
+	{
+	std::vector<uint32_t> w;
+	std::vector<ilimb_t> des;
+	uint64_t acc = 0;
+	int n = 0;
+
+	w.reserve( ( s.length() - first ) * bits / 32 + 1 );
+	for( size_t i = s.length(); i-- > first; )
+		{
+		int digit = IDIGIT10( s[i] );
+		if( digit > 9 )
+			digit = tolower( s[i] ) - 'a' + 10;
+		acc |= (uint64_t)digit << n;
+		n += bits;
+		if( n >= 32 )
+			{
+			w.push_back( (uint32_t)acc );
+			acc >>= 32;
+			n -= 32;
+			}
+		}
+	if( n > 0 )
+		w.push_back( (uint32_t)acc );
+	_int_limb_from_binary( des, w.empty() ? NULL : &w[0], w.size() );
+	return _int_precision_unpack_limbs( &des[0], des.size() );
+	}
+#endif
+
 ///	@author Henrik Vestermark (hve@hvks.com)
 ///	@date  17-sep-2019
 ///	@brief 		std::string _int_precision_atoi
@@ -1698,11 +4553,13 @@ std::string _int_precision_atoi(const char *str, int *sign)
 		if (pos + 1 != s.end() && tolower(pos[1]) == 'x')
 			{
 			std::string c16 = itostring(BASE_16, BASE_10);
+			size_t first = pos + 2 - s.begin();
 			for (pos += 2; pos != s.end(); ++pos)
 				if ((*pos < '0' || *pos > '9') && (tolower(*pos) < 'a' || tolower(*pos) > 'f'))
 					{
 					throw int_precision::bad_int_syntax();
 					}
+#ifndef _INT_PRECISION_LIMB_KERNELS
 				else
 					if (RADIX != BASE_16)
 						{
@@ -1717,6 +4574,10 @@ std::string _int_precision_atoi(const char *str, int *sign)
 						tmp = itostring(hexvalue, BASE_10);
 						number = _int_precision_uadd(&number, &tmp);
 						}
+#else
+			if (RADIX != BASE_16)
+				number = _int_precision_atoi_binary(s, first, 4);
+#endif
 
 			if (RADIX == BASE_16)
 				number = s.substr(2);
@@ -1724,28 +4585,40 @@ std::string _int_precision_atoi(const char *str, int *sign)
 		else
 			if (pos + 1 != s.end() && tolower(pos[1]) == 'b')
 				{
+				size_t first = pos + 2 - s.begin();
 				for (pos += 2; pos != s.end(); ++pos)
 					if (*pos < '0' || *pos > '1')
 						{
 						throw int_precision::bad_int_syntax();
 						}
+#ifndef _INT_PRECISION_LIMB_KERNELS
 					else
 						if (RADIX != BASE_2)
 							number = build_i_number(number, IDIGIT10(*pos), BASE_2);
+#else
+				if (RADIX != BASE_2)
+					number = _int_precision_atoi_binary(s, first, 1);
+#endif
 
 				if (RADIX == BASE_2)
 					number = s.substr(2);
 				}
 			else
 				{ // Collect octal represenation
+				size_t first = pos - s.begin();
 				for (; pos != s.end(); ++pos)
 					if (*pos < '0' || *pos > '7')
 						{
 						throw int_precision::bad_int_syntax();
 						}
+#ifndef _INT_PRECISION_LIMB_KERNELS
 					else
 						if( RADIX != BASE_8 ) // If decimal representation is different from internal format then build number otherwise the internal representation is the same as the decimal representation
 							number = build_i_number(number, IDIGIT10(*pos), BASE_8);
+#else
+				if (RADIX != BASE_8)
+					number = _int_precision_atoi_binary(s, first, 3);
+#endif
 
 				if (RADIX == BASE_8)
 					number = s.substr(1);
@@ -1763,7 +4636,7 @@ std::string _int_precision_atoi(const char *str, int *sign)
 					number = build_i_number(number, IDIGIT10(*pos), BASE_10);
 
 		if (RADIX == BASE_10)
-			number = s;
+			number = s.substr( *sign == -1 || s[0] == '+' ? 1 : 0 );	// Without the sign
 		}
 
 	if (number.length() == 1 && number[0] == ICHARACTER(0) && *sign == -1 )
@@ -1812,11 +4685,13 @@ std::string _int_precision_atoi( const std::string &s, int *sign)
 		if (pos + 1 != s.end() && tolower(pos[1]) == 'x')
 			{
 			std::string c16 = itostring(BASE_16, BASE_10);
+			size_t first = pos + 2 - s.begin();
 			for (pos += 2; pos != s.end(); ++pos)
 				if ((*pos < '0' || *pos > '9') && (tolower(*pos) < 'a' || tolower(*pos) > 'f'))
 					{
 					throw int_precision::bad_int_syntax();
 					}
+#ifndef _INT_PRECISION_LIMB_KERNELS
 				else
 					if (RADIX != BASE_16)
 						{
@@ -1831,6 +4706,10 @@ std::string _int_precision_atoi( const std::string &s, int *sign)
 						tmp = itostring(hexvalue, BASE_10);
 						number = _int_precision_uadd(&number, &tmp);
 						}
+#else
+			if (RADIX != BASE_16)
+				number = _int_precision_atoi_binary(s, first, 4);
+#endif
 
 			if (RADIX == BASE_16)
 				number = s.substr(2);
@@ -1838,28 +4717,40 @@ std::string _int_precision_atoi( const std::string &s, int *sign)
 		else
 			if (pos + 1 != s.end() && tolower(pos[1]) == 'b')
 				{
+				size_t first = pos + 2 - s.begin();
 				for (pos += 2; pos != s.end(); ++pos)
 					if (*pos < '0' || *pos > '1')
 						{
 						throw int_precision::bad_int_syntax();
 						}
+#ifndef _INT_PRECISION_LIMB_KERNELS
 					else
 						if (RADIX != BASE_2)
 							number = build_i_number(number, IDIGIT10(*pos), BASE_2);
+#else
+				if (RADIX != BASE_2)
+					number = _int_precision_atoi_binary(s, first, 1);
+#endif
 
 				if (RADIX == BASE_2)
 					number = s.substr(2);
 				}
 			else
 				{ // Collect octal represenation
+				size_t first = pos - s.begin();
 				for (; pos != s.end(); ++pos)
 					if (*pos < '0' || *pos > '7')
 						{
 						throw int_precision::bad_int_syntax();
 						}
+#ifndef _INT_PRECISION_LIMB_KERNELS
 					else
 						if (RADIX != BASE_8) // If decimal representation is different from internal format then build number otherwise the internal representation is the same as the decimal representation
 							number = build_i_number(number, IDIGIT10(*pos), BASE_8);
+#else
+				if (RADIX != BASE_8)
+					number = _int_precision_atoi_binary(s, first, 3);
+#endif
 
 				if (RADIX == BASE_8)
 					number = s.substr(1);
@@ -1877,7 +4768,7 @@ std::string _int_precision_atoi( const std::string &s, int *sign)
 					number = build_i_number(number, IDIGIT10(*pos), BASE_10);
 
 		if (RADIX == BASE_10)
-			number = s;
+			number = s.substr( *sign == -1 || s[0] == '+' ? 1 : 0 );	// Without the sign
 		}
 
 	if (number.length() == 1 && number[0] == ICHARACTER(0) && *sign == -1)
@@ -1962,6 +4853,182 @@ int_precision abs(const int_precision& x)
 	return x;
 	}
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//
+//    int_precision_modulus
+//
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 			int_precision_modulus::int_precision_modulus
+///	@return 		nothing
+///	@param "m"	-	The modulus. Must not be zero
+///	@todo
+///
+/// Description:
+/// Compute the constants for the modulus |m|. Montgomery multiplication need the modulus to be coprime with the limb base
+/// which for the decimal base means that it must be odd and not a multiple of 5. Any other modulus use Barrett reduction
+//
+int_precision_modulus::int_precision_modulus( const int_precision& m ) : mModulus( m )
+	{
+	if( m == int_precision( 0 ) )
+		throw int_precision::divide_by_zero();
+	mModulus.abs();
+#ifdef _INT_PRECISION_LIMB_KERNELS
+	{
+	std::vector<ilimb_t> ml;
+
+	_int_precision_pack_limbs( ml, mModulus.pointer() );
+	mMontgomery = ( ml[0] & 1 ) != 0 && ( ILIMB_BASE % 5 != 0 || ml[0] % 5 != 0 );
+	if( mMontgomery )
+		_int_limb_mont_init( mMont, &ml[0], ml.size() );
+	else
+		_int_limb_barrett_init( mBarrett, &ml[0], ml.size() );
+	}
+#endif
+	}
+
+#ifdef _INT_PRECISION_LIMB_KERNELS
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 			int_precision_modulus::to_limbs
+///	@return 		void
+///	@param "des"	-	The residue of a as a limb vector. In Montgomery form when Montgomery multiplication is used
+///	@param "a"	-	The int precision number
+///	@todo
+///
+/// Description:
+/// Reduce a and convert it to the representation used by the modular multiplication
+//
+void int_precision_modulus::to_limbs( std::vector<ilimb_t>& des, const int_precision& a ) const
+	{
+	int_precision r( reduce( a ) );
+
+	_int_precision_pack_limbs( des, r.pointer() );
+	if( mMontgomery )
+		{
+		des.resize( mMont.m.size(), 0 );
+		_int_limb_mont_mul( mMont, &des[0], &des[0], &mMont.r2[0] );
+		}
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 			int_precision_modulus::from_limbs
+///	@return 		int_precision	-	The residue
+///	@param "a"	-	The residue as a limb vector from to_limbs() or the modular multiplication. Destroyed
+///	@todo
+///
+/// Description:
+/// Convert a residue back to an int_precision. A Montgomery multiplication with 1 remove the factor R of the Montgomery form
+//
+int_precision int_precision_modulus::from_limbs( std::vector<ilimb_t>& a ) const
+	{
+	int_precision r;
+
+	if( mMontgomery )
+		{
+		std::vector<ilimb_t> one( a.size(), 0 );
+		one[0] = 1;
+		_int_limb_mont_mul( mMont, &a[0], &a[0], &one[0] );
+		}
+	*r.pointer() = _int_precision_unpack_limbs( &a[0], a.size() );
+	return r;
+	}
+#endif
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 			int_precision_modulus::reduce
+///	@return 		int_precision	-	a mod m in the range 0..m-1
+///	@param "a"	-	The int precision number
+///	@todo
+///
+/// Description:
+/// Return the residue of a. Unlike % the result is never negative
+//
+int_precision int_precision_modulus::reduce( const int_precision& a ) const
+	{
+	int_precision r( a );
+
+	r %= mModulus;
+	if( r.sign() < 0 )
+		r += mModulus;
+	return r;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 			int_precision_modulus::mul
+///	@return 		int_precision	-	a*b mod m in the range 0..m-1
+///	@param "a"	-	The first factor
+///	@param "b"	-	The second factor
+///	@todo
+///
+/// Description:
+/// Modular multiplication
+//
+int_precision int_precision_modulus::mul( const int_precision& a, const int_precision& b ) const
+	{
+#ifdef _INT_PRECISION_LIMB_KERNELS
+	std::vector<ilimb_t> al, bl;
+
+	to_limbs( al, a );
+	to_limbs( bl, b );
+	if( mMontgomery )
+		_int_limb_modmul( mMont, al, al, bl );
+	else
+		_int_limb_modmul( mBarrett, al, al, bl );
+	return from_limbs( al );
+#else
+	return reduce( reduce( a ) * reduce( b ) );
+#endif
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 			int_precision_modulus::pow
+///	@return 		int_precision	-	x^e mod m in the range 0..m-1
+///	@param "x"	-	The base
+///	@param "e"	-	The exponent. Must not be negative
+///	@todo
+///
+/// Description:
+/// Modular exponentiation of any size exponent. With the limb kernels the whole calculation stay in the limb representation
+/// and use sliding window exponentiation. A negative exponent throw out_of_range
+//
+int_precision int_precision_modulus::pow( const int_precision& x, const int_precision& e ) const
+	{
+	if( e.sign() < 0 )
+		throw int_precision::out_of_range();
+#ifdef _INT_PRECISION_LIMB_KERNELS
+	std::vector<ilimb_t> xl, el, r, one( 1, 1 );
+	std::vector<uint32_t> eb;
+
+	to_limbs( xl, x );
+	_int_precision_pack_limbs( el, e.pointer() );
+	_int_limb_to_binary( eb, &el[0], el.size() );
+	if( mMontgomery )
+		_int_limb_window_pow( mMont, r, xl, mMont.one, eb, 0 );
+	else
+		_int_limb_window_pow( mBarrett, r, xl, one, eb, 0 );
+	return from_limbs( r );
+#else
+	int_precision p( reduce( x ) ), r( reduce( int_precision( 1 ) ) ), n( e ), two( 2 );
+
+	for( ; n > int_precision( 0 ); n /= two )
+		{
+		if( n.odd() )
+			r = mul( r, p );
+		p = mul( p, p );
+		}
+	return r;
+#endif
+	}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 //
 //
@@ -2005,26 +5072,141 @@ int_precision ipow( const int_precision& x, const int_precision& y )
 ///	@brief 			return the integer power of x^y%z
 ///	@return 		int_precision	-	The integer precision power of x^y%z
 ///	@param "x"	-	The int precision x
-///	@param "y"	-	The int precision y. Max y is 2^32-1
+///	@param "y"	-	The int precision y. Must not be negative
 /// @param "z"	-	The int precision z.
 ///	@todo
 ///
 /// Description:
-/// Return the integer power of x^y%z. For any pratical purose the power y is restricted to 2^32-1
+/// Return the integer power of x^y%z as the residue 0..|z|-1.
+/// The constants for z are computed once by an int_precision_modulus and the power use sliding window exponentiation
 //
 int_precision ipow_modulo( const int_precision& x, const int_precision& y, const int_precision& z )
    {
-   int_precision p(x);
-   int_precision r(1);
+   int_precision_modulus m( z );
+
+   return m.pow( x, y );
+   }
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 			_int_umul128
+///	@return 		uint64_t	-	The low 64 bits of a*b
+///	@param "a"	-	First factor
+///	@param "b"	-	Second factor
+///	@param "hi"	-	The high 64 bits of a*b
+///	@todo
+///
+/// Description:
+/// Full 64x64 bit multiplication. Use the compilers 128bit integer when available and otherwise 32bit halves
+//
+static uint64_t _int_umul128( uint64_t a, uint64_t b, uint64_t *hi )
+	{
+#if defined( __SIZEOF_INT128__ )
+	unsigned __int128 p = (unsigned __int128)a * b;
+	*hi = (uint64_t)( p >> 64 );
+	return (uint64_t)p;
+#else
+	uint64_t al = a & 0xffffffff, ah = a >> 32, bl = b & 0xffffffff, bh = b >> 32;
+	uint64_t ll = al * bl, lh = al * bh, hl = ah * bl;
+	uint64_t mid = ( ll >> 32 ) + ( lh & 0xffffffff ) + ( hl & 0xffffffff );
+	*hi = ah * bh + ( lh >> 32 ) + ( hl >> 32 ) + ( mid >> 32 );
+	return ( mid << 32 ) | ( ll & 0xffffffff );
+#endif
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 			_int_mont64_mul
+///	@return 		uint64_t	-	a*b*2^-64 mod m
+///	@param "a"	-	First factor less than m
+///	@param "b"	-	Second factor less than m
+///	@param "m"	-	The odd modulus
+///	@param "minv"	-	-m^-1 mod 2^64
+///	@todo
+///
+/// Description:
+/// Montgomery multiplication for a 64bit modulus
+//
+static uint64_t _int_mont64_mul( uint64_t a, uint64_t b, uint64_t m, uint64_t minv )
+	{
+	uint64_t hi, lo = _int_umul128( a, b, &hi ), qh, s, r;
+
+	_int_umul128( lo * minv, m, &qh );		// The low half of lo+q*m is zero with a carry unless lo is zero
+	s = hi + qh;
+	r = s + ( lo != 0 );
+	if( s < hi || r < s || r >= m )
+		r -= m;
+	return r;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 			_int_miller_rabin64
+///	@return 		bool	-	true if n is a prime false otherwise
+///	@param "n"	-	The odd number to test. n > 37
+///	@todo
+///
+/// Description:
+/// Deterministic Miller-Rabin test for a 64bit number. The prime bases up to 37 have no common strong pseudoprime below 3.3*10^24
+//
+static bool _int_miller_rabin64( uint64_t n )
+	{
+	static const uint64_t bases[] = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37 };
+	uint64_t minv = n, one, mone, r2, d;
+	int i, r, s;
+
+	for( i = 0; i < 5; ++i )
+		minv *= 2 - n * minv;			// n^-1 mod 2^64. n*n=1 mod 8 so n is correct to 3 bits
+	minv = 0 - minv;
+	one = ( 0 - n ) % n;					// 2^64 mod n
+	mone = n - one;
+	for( r2 = one, i = 0; i < 64; ++i )		// 2^128 mod n
+		r2 = r2 >= n - r2 ? r2 - ( n - r2 ) : r2 + r2;
+	for( d = n - 1, s = 0; ( d & 1 ) == 0; d >>= 1, ++s ) ;
+
+	for( i = 0; i < (int)( sizeof( bases ) / sizeof( bases[0] ) ); ++i )
+		{
+		uint64_t x = _int_mont64_mul( bases[i], r2, n, minv ), y = one;
+		for( int bit = 63; bit >= 0; --bit )
+			{
+			y = _int_mont64_mul( y, y, n, minv );
+			if( ( d >> bit ) & 1 )
+				y = _int_mont64_mul( y, x, n, minv );
+			}
+		if( y == one || y == mone )
+			continue;
+		for( r = 1; r < s; ++r )
+			{
+			y = _int_mont64_mul( y, y, n, minv );
+			if( y == mone )
+				break;
+			}
+		if( r == s )
+			return false;
+		}
+
+	return true;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 			_int_precision_square
+///	@return 		bool	-	true if a is a perfect square
+///	@param "a"	-	The positive int precision number
+///	@todo
+///
+/// Description:
+/// Newton iteration x=(x+a/x)/2 from a start value above the square root decrease until it reach floor(sqrt(a))
+//
+static bool _int_precision_square( const int_precision& a )
+	{
+	int_precision x, y, two(2);
 
-   p%=z;
-   for(int n = y; n > 0; n >>= 1)
-        {
-        if( ( n & 0x1 ) != 0 ) { r *= p; r %= z; } // Odd
-        p *= p;	p %= z;
-        }
-   return r;
-   }
+	x = ipow( int_precision( RADIX ), int_precision( (int)( a.size() + 1 ) / 2 ) );
+	for( y = ( x + a / x ) / two; y < x; y = ( x + a / x ) / two )
+		x = y;
+	return x * x == a;
+	}
 
 ///	@author Henrik Vestermark (hve@hvks.com)
 ///	@date  2/Sep/2012
@@ -2035,6 +5217,11 @@ int_precision ipow_modulo( const int_precision& x, const int_precision& y, const
 ///
 /// Description:
 /// Return true if the integer prime is a prime number.
+/// After trial division with the primes below 100 a number that fit in 64 bits is tested with the deterministic Miller-Rabin test.
+/// A larger number is tested with the Baillie-PSW test, a Miller-Rabin test to base 2 followed by a strong Lucas test.
+/// No composite number is known to pass it and there is none below 2^64. Both use Montgomery multiplication and take
+/// O(log n) modular multiplications so a few hundred digits is instant.
+/// Without the limb kernels a larger number use trial division.
 /// All integers are of the form 30k + i for i = 0, 1, 2,...,29 and k an integer from 0..  However, 2 divides 0, 2, 4,...,28 and 3 divides 0, 3, 6,...,27 and 5 divides 0, 5, 10,...,25.
 /// So all prime numbers are of the form 30k + i for i = 1, 7, 11, 13, 17, 19, 23, 29 (i.e. for i < 30 such that gcd(i,30) = 1).
 /// Note that if i and 30 are not coprime, then 30k + i is divisible by a prime divisor of 30, namely 2, 3 or 5, and is therefore not prime.
@@ -2042,13 +5229,43 @@ int_precision ipow_modulo( const int_precision& x, const int_precision& y, const
 ///
 bool iprime(const int_precision& prime)
 	{
-	int precheck[11] = { 10, 2, 3, 5, 7, 11, 13, 17, 19, 23, 29 };
+	static const int precheck[] = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67, 71, 73, 79, 83, 89, 97 };
 	int primes[9] = { 8, 1, 7, 11, 13, 17, 19, 23, 29 };
 	int_precision count, kp(30), mod;
+	uint64_t u = 0;
 	int i;
 
-	for (i = 1; i <= precheck[0]; i++)
+	if( prime < int_precision( 2 ) )
+		return false;
+	for (i = 0; i < (int)( sizeof( precheck ) / sizeof( precheck[0] ) ); i++)
 	if ((int)(prime % (int_precision)precheck[i]) == 0) return prime==int_precision(precheck[i]);
+	if( prime < int_precision( 97 * 97 ) )
+		return true;
+
+	for( i = 0; i < (int)prime.size() && u <= ( ~(uint64_t)0 - ( RADIX - 1 ) ) / RADIX; i++ )
+		u = u * RADIX + IDIGIT( (*prime.pointer())[i] );
+	if( i == (int)prime.size() )
+		return _int_miller_rabin64( u );	// It fit in 64 bits
+#ifdef _INT_PRECISION_LIMB_KERNELS
+	{
+	std::vector<ilimb_t> n;
+	_int_limb_montgomery ctx;
+	long d;
+	int j;
+
+	_int_precision_pack_limbs( n, prime.pointer() );
+	_int_limb_mont_init( ctx, &n[0], n.size() );
+	if( !_int_limb_strong_probable_prime( ctx, 2 ) )
+		return false;
+	// Selfridge: The first D in 5,-7,9,-11,... with (D/n)=-1. It does not exist for a square
+	for( d = 5, i = 0; ( j = _int_limb_jacobi( d, &n[0], n.size() ) ) != -1; d = d > 0 ? -d - 2 : -d + 2, ++i )
+		{
+		if( j == 0 || ( i == 8 && _int_precision_square( prime ) ) )
+			return false;
+		}
+	return _int_limb_strong_lucas( ctx, d );
+	}
+#endif
 
 	for (; kp * kp < prime; kp += 30)   //Loop to divide the number by every number 6*count-1 and 6*count+1 and count < sqrt(i)
 		{
@@ -2078,6 +5295,7 @@ bool iprime(const int_precision& prime)
 /// Return the greatest common divisor of the two numbers a & b.
 /// It used the Binary gcd method only using shifting and subtraction
 /// Change to also handle negative arguments a,b;
+/// With the limb kernels it use Lehmer steps and the half gcd on the limb vectors instead
 ///
 int_precision gcd( const int_precision& a, const int_precision& b )
 	{
@@ -2088,6 +5306,18 @@ int_precision gcd( const int_precision& a, const int_precision& b )
 	// GCD(0,v)==v; GCD(u,0)==0; GCD(0,0)==0
 	if (a == i0) return b;
 	if (b == i0) return a;
+#ifdef _INT_PRECISION_LIMB_KERNELS
+	{
+	std::vector<ilimb_t> la, lb;
+
+	_int_precision_pack_limbs( la, a.pointer() );
+	_int_precision_pack_limbs( lb, b.pointer() );
+	_int_limb_gcd( la, lb );
+	u = i0;
+	*u.pointer() = _int_precision_unpack_limbs( &la[0], la.size() );
+	return u;
+	}
+#endif
 	u = a; v = b; if(u < i0) u = -u; if(v < i0) v = -v;
 	for (shift = 0; ; ++shift )
 		{
@@ -2941,15 +6171,17 @@ float_precision _float_precision_atof( const char *str, unsigned int p, enum rou
 ///
 /// Description:
 ///   Remove leading nosignificant zeros
+///   The zeros are counted first and removed with a single erase
 //
 void _float_precision_strip_leading_zeros( std::string *s )
 	{
-	std::string::iterator pos;
+	std::string::size_type count;
 
 	// Strip leading zeros
-	for( pos = s->begin(); pos != s->end() && FDIGIT( *pos ) == 0; )
-		s->erase( pos );
+	for( count = 0; count < s->length() && FDIGIT( (*s)[count] ) == 0; count++ )
+		;
 
+	s->erase( 0, count );
 	if( s->length() == 0 )
 		*s = FCHARACTER(0);
 
@@ -3037,25 +6269,26 @@ void _float_precision_left_shift( std::string *s, int shift )
 ///   it has and adjust the exponent accordingly and return it.
 ///   2) Then remove trailing zeros
 ///   3) The mantissa NEVER contain a leading sign
+///   The leading zeros are counted first and removed with a single erase so it is linear in the length of the mantissa
 //
 int _float_precision_normalize( std::string *m )
 	{
-	int expo = 0;
-	std::string::iterator pos;
+	std::string::size_type count;
 
 	// Left shift until a digit is not 0
-	for( pos = m->begin(); pos != m->end() && FDIGIT( *pos ) == 0; )
-		{
-		m->erase( pos );
-		expo--;
-		}
+	for( count = 0; count < m->length() && FDIGIT( (*m)[count] ) == 0; count++ )
+		;
 
-	if( m->length() == 0 ) // If all zero the number is zero
+	if( count == m->length() ) // If all zero the number is zero
 		{
 		*m = FCHARACTER(0);
 		return 0;
 		}
 
+	int expo = -(int)count;
+
+	m->erase( 0, count );
+
 	_float_precision_strip_trailing_zeros( m );
 
 	return expo;
@@ -3088,6 +6321,7 @@ int _float_precision_normalize( std::string *m )
 ///   Rounding toward zero (Truncate)  Maximum, negative finite value
 ///   Rounding up (toward +·)          Maximum, negative finite value
 ///   Rounding down) (toward -·)       -·
+///   The mantissa is truncated and rounded up in place without building a new string
 //
 int _float_precision_rounding( std::string *m, int sign, unsigned int precision, enum round_mode mode )
    {
@@ -3113,19 +6347,17 @@ int _float_precision_rounding( std::string *m, int sign, unsigned int precision,
       m->erase( (std::string::size_type)precision, m->length() - precision );
 
       if( rm == ROUND_UP )
-         {
-         unsigned int before;
-
-         before = m->length();
-         *m = _float_precision_uadd_short( m, 1 );
-         if( m->length() > before )
-            {
-            if( m->length() > precision )
-               m->erase( (std::string::size_type)precision, m->length() - precision );
-
-            _float_precision_strip_trailing_zeros( m );
+         {// Add one in place. Only a carry out of the most significant digit change the length
+         std::string::reverse_iterator pos;
+
+         for( pos = m->rbegin(); pos != m->rend() && FDIGIT( *pos ) == F_RADIX - 1; pos++ )
+            *pos = FCHARACTER( 0 );
+         if( pos == m->rend() )
+            {// All digits was F_RADIX-1 so the result is 1 followed by zeros that are not significant
+            *m = FCHARACTER( 1 );
             return 1;
             }
+         *pos = FCHARACTER( (char)( FDIGIT( *pos ) + 1 ) );
          }
       }
 
@@ -3338,6 +6570,18 @@ std::string _float_precision_usub( int *result, std::string *src1, std::string *
    std::string::iterator d_pos;
    std::string des1;
 
+#ifdef _INT_PRECISION_LIMB_KERNELS
+   if( F_RADIX == RADIX )
+      {// Same digit representation as int_precision. Use the limb kernel and keep the leading zeros of the mantissa
+      std::string::size_type length = src1->length() > src2->length() ? src1->length() : src2->length();
+
+      des1 = _int_precision_usub( result, src1, src2 );
+      if( des1.length() < length )
+         des1.insert( (std::string::size_type)0, length - des1.length(), FCHARACTER( 0 ) );
+      return des1;
+      }
+#endif
+
    des1.erase();
    d_pos = des1.begin();
    r1_pos = src1->rbegin();
@@ -3431,7 +6675,8 @@ std::string _float_precision_umul_short( std::string *src1, unsigned int d )
 /// Description:
 ///   Multiply two unsigned decimal strings
 ///   Optimized: Used early out add and multiplication w. zero
-///   NO LONGER IN USE. Replaced by _float_precision_umul_fourier
+///   When _INT_PRECISION_LIMB_KERNELS is defined and F_RADIX==RADIX the int_precision limb multiplication is used.
+///   operator*= use it below precision_ctrl.mul_limb_threshold() digits and _float_precision_umul_fourier above
 //
 std::string _float_precision_umul( std::string *src1, std::string *src2 )
    {
@@ -3439,6 +6684,11 @@ std::string _float_precision_umul( std::string *src1, std::string *src2 )
    std::string des1, tmp;
    std::string::reverse_iterator r_pos2;
 
+#ifdef _INT_PRECISION_LIMB_KERNELS
+   if( F_RADIX == RADIX )
+      return _int_precision_umul( src1, src2 );
+#endif
+
    r_pos2 = src2->rbegin();
    des1 = _float_precision_umul_short( src1, FDIGIT( *r_pos2 ) );
    for( r_pos2++, disp = 1; r_pos2 != src2->rend(); disp++, r_pos2++ )
@@ -3456,6 +6706,78 @@ std::string _float_precision_umul( std::string *src1, std::string *src2 )
    return des1;
    }
 
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	multiply two floating point string and only compute the leading digits
+///	@return 	std::string - Return the leading digits of the multiplied string
+///	@param   "src1"	-	The first source string
+///   @param   "src2"  - The second source string
+///   @param   "precision"  - The number of digits the product is rounded to
+///   @param   "drop"  - Return the number of trailing digits of the full product that is not in the returned string
+///
+///	@todo
+///
+/// Description:
+///   Short product for operator*= that does not compute the trailing digits that are thrown away by the rounding.
+///   The operands are cut to precision plus guard digits and the mantissa is multiplied with _int_limb_mul_high() with
+///   a few extra limbs. The result is a lower bound of the product with a known error bound. If the digits after
+///   the rounding digit and above the error bound are all 0 or all F_RADIX-1 the rounding could depend on the missing digits
+///   and the full product from _float_precision_umul() is returned instead so the rounded result is always the same
+///   as rounding the full product. Only with _INT_PRECISION_LIMB_KERNELS and F_RADIX==RADIX otherwise it is the full product
+//
+std::string _float_precision_umul_high( std::string *src1, std::string *src2, unsigned int precision, int *drop )
+   {
+   *drop = 0;
+#ifdef _INT_PRECISION_LIMB_KERNELS
+   const size_t g = 3, guard = 2 * ILIMB_DIGITS;	// Extra limbs in the short product and extra digits of the operands
+   size_t l1 = src1->length(), l2 = src2->length(), t = precision + guard;
+   size_t t1 = l1 < t ? l1 : t, t2 = l2 < t ? l2 : t, tt = t1 < t2 ? t2 : t1;
+
+   if( F_RADIX == RADIX && l1 + l2 > precision + guard + tt / 2 && 4 * ( t1 < t2 ? t1 : t2 ) >= 3 * tt && tt >= 4 * ILIMB_DIGITS )
+      {
+      std::string a( *src1, 0, t1 ), b( *src2, 0, t2 ), s;
+      std::vector<ilimb_t> va, vb, c;
+      size_t i, n, e, nd, cnt, zeros, nines;
+
+      // Both operands get tt digits so they have the same number of limbs. The g low zero limbs make the short product keep g more limbs
+      a.append( tt - t1, FCHARACTER( 0 ) );
+      b.append( tt - t2, FCHARACTER( 0 ) );
+      _int_precision_pack_limbs( va, &a );
+      _int_precision_pack_limbs( vb, &b );
+      n = va.size();
+      va.insert( va.begin(), g, 0 );
+      vb.insert( vb.begin(), g, 0 );
+      c.resize( 2 * ( n + g ) );
+      _int_limb_mul_high( &c[0], &va[0], &vb[0], n + g );
+      s = _int_precision_unpack_limbs( &c[2*g], 2 * n );
+
+      // The error is less than (n+g)*ILIMB_BASE^(n-g) from the short product plus 3*RADIX^tt if the operands was cut
+      for( nd = 1, i = n + g; i >= 10; i /= 10 )
+         ++nd;
+      e = ILIMB_DIGITS * ( n > g ? n - g : 0 ) + nd;
+      if( ( t1 < l1 || t2 < l2 ) && e < tt + 1 )
+         e = tt + 1;
+      ++e;
+      if( s.length() > precision + 1 + e )
+         {
+         cnt = s.length() - e - precision - 1;
+         for( zeros = nines = 0, i = precision + 1; i < s.length() - e; ++i )
+            if( s[i] == FCHARACTER( 0 ) )
+               ++zeros;
+            else
+               if( s[i] == FCHARACTER( F_RADIX - 1 ) )
+                  ++nines;
+         if( zeros < cnt && nines < cnt )
+            {
+            *drop = (int)( l1 - t1 ) + (int)( l2 - t2 ) - (int)( tt - t1 ) - (int)( tt - t2 );
+            return s;
+            }
+         }
+      }
+#endif
+   return _float_precision_umul( src1, src2 );
+   }
+
 ///	@author Henrik Vestermark (hve@hvks.com)
 ///	@date  1/21/2005
 ///	@brief 	multiply two floating point string unsing a fourie transformation
@@ -3685,6 +7007,190 @@ std::string _float_precision_urem( std::string *src1, std::string *src2 )
    return des;
    }
 
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_float_precision_u64tof
+///	@return 	void	-
+///	@param   "des"	-	Receive the BASE_10 digits of v
+///	@param   "v"	-	The 64bit value to convert
+///
+///	@todo
+///
+/// Description:
+///   Write the decimal digits of v into des. The digits are assigned into the existing string
+///   so no memory is allocated when they fit in the string capacity or the short string buffer
+//
+static void _float_precision_u64tof( std::string *des, uint64_t v )
+	{
+	char buf[ 20 ];
+	int i = 20;
+
+	do
+		buf[ --i ] = FCHARACTER( (char)( v % 10 ) );
+	while( ( v /= 10 ) != 0 );
+	des->assign( buf + i, 20 - i );
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_float_precision_add64
+///	@return 	bool	-	true if the sum was calculated otherwise false and nothing is changed
+///	@param   "des"	-	Normalized mantissa of the sum. May be one of the source mantissas
+///	@param   "expo"	-	Exponent of the sum
+///	@param   "sign"	-	Sign of the sum
+///	@param   "src1"	-	Mantissa of the first operand
+///	@param   "expo1"	-	Exponent of the first operand
+///	@param   "sign1"	-	Sign of the first operand
+///	@param   "src2"	-	Mantissa of the second operand
+///	@param   "expo2"	-	Exponent of the second operand
+///	@param   "sign2"	-	Sign of the second operand
+///
+///	@todo
+///
+/// Description:
+///   Small value fast path for float_precision +=
+///   When both operands aligned to the same exponent fit in 18 BASE_10 digits they are added or subtracted
+///   as 64bit integers. This is the common case for numbers entered on the calculator keypad
+///   The sum is exact. Rounding to the precision of the result is left to the caller
+//
+bool _float_precision_add64( std::string *des, int *expo, int *sign, const std::string *src1, int expo1, int sign1, const std::string *src2, int expo2, int sign2 )
+	{
+	int low1 = expo1 - (int)src1->length() + 1, low2 = expo2 - (int)src2->length() + 1;
+	int low = std::min( low1, low2 );
+	uint64_t a, b, sum;
+
+	if( F_RADIX != BASE_10 || std::max( expo1, expo2 ) - low >= 18 )
+		return false;
+
+	a = _stringtou64( (std::string *)src1, BASE_10 );
+	b = _stringtou64( (std::string *)src2, BASE_10 );
+	for( ; low1 > low; --low1 )
+		a *= 10;
+	for( ; low2 > low; --low2 )
+		b *= 10;
+
+	if( sign1 == sign2 )
+		{
+		sum = a + b;
+		*sign = sign1;
+		}
+	else
+		if( a >= b )
+			{
+			sum = a - b;
+			*sign = sign1;
+			}
+		else
+			{
+			sum = b - a;
+			*sign = sign2;
+			}
+
+	if( sum == 0 )
+		{// Result zero
+		*des = FCHARACTER( 0 );
+		*expo = 0;
+		*sign = 1;
+		return true;
+		}
+
+	_float_precision_u64tof( des, sum );
+	*expo = low + (int)des->length() - 1;
+	_float_precision_strip_trailing_zeros( des );
+	return true;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_float_precision_umul64
+///	@return 	std::string	-	the result of multiplying src1 and src2
+///	@param   "src1"	-	First mantissa
+///	@param   "src2"	-	Second mantissa
+///
+///	@todo
+///
+/// Description:
+///   Multiply two mantissas by converting them to binary and do the multiplication with native 64bit arithmetic
+///   Same as _int_precision_umul64(). The calling function must quarantee the product fit in 19 BASE_10 digits
+//
+std::string _float_precision_umul64( std::string *src1, std::string *src2 )
+	{
+	uint64_t a = _stringtou64( src1, F_RADIX );
+	uint64_t b = _stringtou64( src2, F_RADIX );
+	a *= b;
+	return u64to_precision_string( a, F_RADIX );
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_float_precision_div64
+///	@return 	bool	-	true if the quotient was calculated otherwise false and nothing is changed
+///	@param   "des"	-	Normalized mantissa of the quotient. May be one of the source mantissas
+///	@param   "expo"	-	Exponent of the quotient
+///	@param   "src1"	-	Mantissa of the dividend
+///	@param   "expo1"	-	Exponent of the dividend
+///	@param   "src2"	-	Mantissa of the divisor
+///	@param   "expo2"	-	Exponent of the divisor
+///	@param   "precision"	-	Number of significant digits needed in the quotient
+///
+///	@todo
+///
+/// Description:
+///   Small value fast path for float_precision /=
+///   When both mantissas fit in 18 BASE_10 digits the quotient digits are generated by long division
+///   with native 64bit arithmetic instead of multiplying with the Newton inverse of the divisor.
+///   One digit more than precision is generated and a trailing 1 is added if the division is inexact
+///   so _float_precision_rounding() round the quotient correctly in all rounding modes.
+///   A zero divisor is left to the caller
+//
+bool _float_precision_div64( std::string *des, int *expo, const std::string *src1, int expo1, const std::string *src2, int expo2, unsigned int precision )
+	{
+	int len1 = (int)src1->length(), len2 = (int)src2->length(), lead, k;
+	uint64_t a, b, q, r;
+
+	if( F_RADIX != BASE_10 || len1 > 18 || len2 > 18 )
+		return false;
+	a = _stringtou64( (std::string *)src1, BASE_10 );
+	b = _stringtou64( (std::string *)src2, BASE_10 );
+	if( a == 0 || b == 0 )
+		return false;
+
+	q = a / b;
+	r = a % b;
+	lead = 0;
+	if( q != 0 )
+		{
+		_float_precision_u64tof( des, q );
+		lead = (int)des->length() - 1;
+		}
+	else
+		des->erase();
+
+	// Generate the fraction digits. r*10 < 10*b < 10^19 fit in 64 bits
+	for( k = 0; r != 0 && des->length() <= precision; )
+		{
+		unsigned int d;
+
+		r *= 10;
+		d = (unsigned int)( r / b );
+		r %= b;
+		++k;
+		if( des->empty() && d == 0 )  // Leading zeros of a quotient less than one
+			continue;
+		if( des->empty() )
+			lead = -k;
+		des->append( 1, FCHARACTER( (char)d ) );
+		}
+
+	if( r != 0 )
+		des->append( 1, FCHARACTER( 1 ) );	// Sticky digit for an inexact quotient
+	else
+		_float_precision_strip_trailing_zeros( des );
+
+	*expo = lead + expo1 - expo2 - len1 + len2;
+	return true;
+	}
+
 ///	@author Henrik Vestermark (hve@hvks.com)
 ///	@date  8/26/2007
 ///	@brief 	return the epsilon such that 1.0+epsilon!=1.0
@@ -3740,6 +7246,19 @@ float_precision float_precision::epsilon()
 //////////////////////////////////////////////////////////////////////////////////////
 
 
+// The working precisions of Newton iterations that double the number of correct digits each step from a double seed
+// until precision digits. The steps are returned from the last to the first
+static void _float_precision_newton_steps( unsigned int precision, std::vector<unsigned int> *steps )
+	{
+	steps->clear();
+	for( unsigned int digits = precision; ; digits = digits / 2 + 2 )
+		{
+		steps->push_back( digits );
+		if( digits <= 16 )
+			break;
+		}
+	}
+
 ///	@author Henrik Vestermark (hve@hvks.com)
 ///	@date  1/21/2005
 ///	@brief 		Calculate the inverse of a
@@ -3750,8 +7269,10 @@ float_precision float_precision::epsilon()
 ///
 /// Description:
 ///   Inverse of V
-///   Using a Newton iterations Un = U(2-UV)
-///   Always return the result with 2 digits higher precision that argument
+///   Using a Newton iterations Un = U+U(1-UV)
+///   Each iteration double the number of correct digits so it is done at twice the precision of the previous
+///   starting from the double seed. The total cost is a small constant times one multiplication at full precision
+///   Always return the result with 3 digits higher precision that argument
 ///   _float_precision_inverse() return a interim result for a basic operation like /
 //
 float_precision _float_precision_inverse( const float_precision& a )
@@ -3759,13 +7280,14 @@ float_precision _float_precision_inverse( const float_precision& a )
    unsigned int precision;
    int i, imax, expo;
    double fv, dv, fu;
-   float_precision r, u, v, c2;
-   std::string::reverse_iterator rpos;
+   float_precision r, u, v;
+   const float_precision c1(1);
+   std::vector<unsigned int> steps;
    std::string::iterator pos;
    std::string *p;
 
    precision = a.precision();
-   v.precision( precision + 2 );
+   v.precision( precision + 3 );
    v = a;
    p= v.ref_mantissa();
    if( p->length() == 1 && FDIGIT( (*p)[0] ) == 0 )
@@ -3773,9 +7295,6 @@ float_precision _float_precision_inverse( const float_precision& a )
 
    expo = v.exponent();
    v.exponent( 0 );
-   r.precision( precision + 3 ); // Do iteration using 3 digits higher precision
-   u.precision( precision + 3 );
-   c2 = float_precision( 2, precision + 3 );
 
  	// New. Get a initial guess using ordinary floating point
 	pos = v.ref_mantissa()->begin();
@@ -3791,18 +7310,17 @@ float_precision _float_precision_inverse( const float_precision& a )
    fu = 1 / fv;
    u = float_precision( fu );
 
-   // Now iterate using Netwon Un=U(2-UV)
-   for(;;)
+   // Now iterate using Netwon Un=U+U(1-UV) doubling the precision each step
+   _float_precision_newton_steps( precision + 3, &steps );
+   for( i = (int)steps.size() - 1; i >= 0; --i )
       {
-      r = u * v;                 // UV
-      r = c2-r;                  // 2-UV
-      u *= r;                    // Un=U(2-UV)
-      for( pos = r.ref_mantissa()->begin(), pos++, i = 0; pos != r.ref_mantissa()->end(); i++, pos++ )
-         if( FDIGIT( *pos ) )
-            break;
-
-      if( pos == r.ref_mantissa()->end() || (unsigned)i >= precision )
-         break;
+      r.precision( steps[i] );
+      u.precision( steps[i] );
+      r = v;                     // V rounded to the step precision
+      r *= u;                    // UV
+      r = c1 - r;                // 1-UV
+      r *= u;                    // U(1-UV)
+      u += r;                    // Un=U+U(1-UV)
       }
 
    u.exponent( u.exponent() - expo );
@@ -3825,22 +7343,22 @@ float_precision _float_precision_inverse( const float_precision& a )
 ///   sqrt(V)
 ///   Equivalent with the same standard C function call
 ///   Seperate exponent. e.g. sqrt(V*10^x)=10^x/2*sqrt(V)
-///   Un=0.5U(3-VU^2)
+///   Un=U+0.5U(1-VU^2)
 ///   Then Un == 1/Sqrt(V). and sqrt(V) = VUn
-/// The functionhas been improved using Newton with iterative deepening creating
-///	a speed up with a factor of 3 over the classic Newton method.
+///   Each iteration double the number of correct digits so it is done at twice the precision of the previous
+///   starting from the double seed. 1/Sqrt(V) is only needed to half the precision since the last step
+///   S=VU, sqrt(V)=S+0.5U(V-S^2) double the digits again
 //
 float_precision sqrt(const float_precision& x)
 	{
 	const unsigned int extra = 2;
 	unsigned int precision;
-	unsigned int digits;
 	int expo, expo_sq, i, imax;
 	double fv, dv;
-	float_precision r, u, v, tmp;
-	const float_precision c0(0), c1(1), c3(3);
+	float_precision r, s, u, v;
+	const float_precision c0(0), c1(1);
 	const float_precision c05(0.5);
-	std::string::reverse_iterator rpos;
+	std::vector<unsigned int> steps;
 	std::string::iterator pos;
 
 	if (x == c0 || x == c1)
@@ -3853,11 +7371,8 @@ float_precision sqrt(const float_precision& x)
 	expo = v.exponent();
 	expo_sq = expo / 2;
 	v.exponent(expo - 2 * expo_sq);
-	r.precision(precision + extra); // Do iteration using 2 digits higher precision
-	u.precision(precision + extra);
 
 	// Get a initial guess using ordinary floating point
-	// New. Get a initial guess using ordinary floating point
 	pos = v.ref_mantissa()->begin();
 	fv = FDIGIT(*pos);
 	imax = digits_to_check();
@@ -3866,13 +7381,6 @@ float_precision sqrt(const float_precision& x)
 		dv /= (double)F_RADIX;
 		fv += FDIGIT(*pos) * dv;
 		}
-//	rpos = v.ref_mantissa()->rbegin();
-//	dv = FDIGIT(*rpos);
-//	for (++rpos; rpos != v.ref_mantissa()->rend(); ++rpos )
-//		{
-//		dv *= (double)1 / (double)F_RADIX;
-//		dv += FDIGIT(*rpos);
-//		}
 
 	if (expo - 2 * expo_sq > 0)
 		fv *= (double)F_RADIX;
@@ -3881,340 +7389,467 @@ float_precision sqrt(const float_precision& x)
 			fv /= (double)F_RADIX;
 	fv = 1 / sqrt(fv);  // set the initial guess with at approx 16 correct digits
 
-	tmp.precision(precision+1);
 	u = float_precision(fv);
-	// Now iterate using Netwon Un=0.5U(3-VU^2)
-	for (digits = min((unsigned)32, precision); ; digits = min(precision + 2, digits * 2))
+	// Now iterate using Netwon Un=U+0.5U(1-VU^2) doubling the precision each step up to half the final precision
+	_float_precision_newton_steps(precision + extra, &steps);
+	for (i = (int)steps.size() - 1; i >= 1; --i)
 		{
-		// Increase precision by a factor of two for the working variable s r & u.
-		r.precision(digits);
-		u.precision(digits);
-		// Notice V is the original number to squareroot which has the full precision
-		// so we start by assigning it to r, rounding it to the precision of r
-		r = v;						// V
-		r *= u * u;					// VU^2
-		r = c3 - r;					// 3-VU^2
-		r *= c05;					// (3-VU^2)/2
-		u *= r;						// U=U(3-VU^2)/2
-		if (digits == precision + 2) // Reach final iteration step in regards to precision
-			{
-			tmp = r;		// round to final precision
-			if (tmp == c1)	// break if no improvement
-				break;
-			}
+		r.precision(steps[i]);
+		u.precision(steps[i]);
+		r = v;						// V rounded to the step precision
+		r *= u;						// VU
+		r *= u;						// VU^2
+		r = c1 - r;					// 1-VU^2
+		r *= u;						// U(1-VU^2)
+		r *= c05;					// 0.5U(1-VU^2)
+		u += r;						// Un=U+0.5U(1-VU^2)
 		}
 
-	u *= v;
-	u.exponent(u.exponent() + expo_sq);
+	// The last step. S=VU and sqrt(V)=S+0.5U(V-S^2)
+	s.precision(steps[0]);
+	r.precision(steps[0]);
+	s = v;
+	s *= u;							// S=VU
+	r = s;
+	r *= s;							// S^2
+	r = v - r;						// V-S^2
+	r *= u;							// U(V-S^2)
+	r *= c05;						// 0.5U(V-S^2)
+	s += r;							// sqrt(V)=S+0.5U(V-S^2)
+
+	s.exponent(s.exponent() + expo_sq);
 	// Round to same precision as argument and mrounding mode
-	u.mode(x.mode());
-	u.precision(precision);
+	s.mode(x.mode());
+	s.precision(precision);
 
-	return u;
+	return s;
 	}
 
 
 //////////////////////////////////////////////////////////////////////////////////////
 ///
 /// FLOAT PRECISION
-///    Universal Constants LN2, LN10, e and PI
+///    Binary splitting series
 ///
 //////////////////////////////////////////////////////////////////////////////////////
 
-/// Spigot function for internal calculation of transcendental constants
+// The terms of a series sum a(k)/b(k) * p(0)...p(k)/(q(0)...q(k)) for k=0,1,2...
+// arg hold the argument u/v of the series as u, v, u^2 and v^2
+typedef void (*_float_precision_term)( unsigned int, const int_precision *, int_precision *, int_precision *, int_precision *, int_precision * );
 
-///	@author Henrik Vestermark (hve@hvks.com)
-///	@date  29/Jan/2017
-///	@brief 	Calculate transcendetal constant of pi
-///	@return std::string -	return the constant as a standard std::string
-///	@param   "digits"	-	Number of digits
-/// @param   "no_dig"	-	Number of digits calculated per loop
-///
-///	@todo
-///
-/// Description:
-///
-// 64bit version of the spigot algorithm.
-// Notice acc, a, g needs to be unsigned 64bit.
-// Emperisk for pi to 2^n digits, acc need to hold approx 2^(n+17) numbers. while a[] and g needs approx 2^(n+3) numbers
-// a[] & g could potential be unsigned long (32bit) going to a max of 2^29 digit or 536millions digit of PI. but with
-// unsigned 64bit you can do "unlimited"
-static std::string spigot_pi_64(const int digits, int no_dig = 4)
-	{
-	static unsigned long f_table[] = { 0, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000 };
-	static unsigned long f2_table[] = { 0,  2,  20,  200,  2000,  20000,  200000,  2000000,  20000000 };
-	const int TERMS = (10 * no_dig / 3 + 1);
-	bool first_time = true;									// First time in loop flag
-	bool overflow_flag = false;								// Overflow flag
-	char buffer[32];
-	std::string ss;											// The String that hold the calculated PI											// Timer
-	long b, c;												// Loop counters
-	int carry, no_carry = 0;								// Outer loop carrier, plus no of carroer adjustment counts
-	unsigned long f, f2;									// New base 1 decimal digits at a time
-	unsigned long dig_n = 0;								// dig_n holds the next no_dig digit to add
-	unsigned long e = 0;									// Save previous 4 digits
-	uint64_t acc = 0, g = 0, tmp64;
-	ss.reserve(digits + 16);								// Pre reserve the string size to be able to accumulate all digits plus 8
-	if (no_dig > 8) no_dig = 8;								// ensure no_dig<=8
-	if (no_dig < 1) no_dig = 1;								// Ensure no_dig>0
-	c = (digits / no_dig + 1) * no_dig;						// Since we do collect PI in trunks of no_dig digit at a time we need to ensure digits is divisble by no_dig.
-	if (no_dig == 1) c++;									// Extra guard digit for 1 digit at a time.
-	c = (c / no_dig + 1) * TERMS;							// c ensure that the digits we seek is divisble by no_dig
-	f = f_table[no_dig];									// Load the initial f
-	f2 = f2_table[no_dig];									// Load the initial f2
-
-	uint64_t *a = new uint64_t[c];								// Array of 4 digits decimals
-																// b is the nominator previous base; c is the index
-	for (; (b = c -= TERMS) > 0 && overflow_flag == false; first_time = false)
+// exp(u/v) = sum (u/v)^k/k!
+static void _float_precision_term_exp( unsigned int k, const int_precision *arg, int_precision *p, int_precision *q, int_precision *b, int_precision *a )
+	{
+	if( k == 0 )
 		{
-		for (; --b > 0 && overflow_flag == false;)
-			{
-			if (acc > ULLONG_MAX / b) overflow_flag = true;		// Check for overflow
-			acc *= b;											// Accumulator *= nom previous base
-			tmp64 = f;
-			if (first_time == true)								// Test for first run in the main loop
-				tmp64 *= f2;									// First outer loop. a[b] is not yet initialized
-			else
-				tmp64 *= a[b];									// Non first outer loop. a[b] is initialized in the first loop
-			if (acc > ULLONG_MAX - tmp64) overflow_flag = true;	// Check for overflow
-			acc += tmp64;										// add it to accumulator
-			g = b + b - 1;										// denominated previous base
-			a[b] = acc % g;										// Update the accumulator
-			acc /= g;											// save carry
-			}
-		dig_n = (unsigned long)(e + acc / f);					// Get previous no_dig digits. Could occasinaly be no_dig+1 digits in which case we have to propagate back the extra digit.
-		carry = (unsigned)(dig_n / f);							// Check for extra carry that we need to propagate back into the current sum of PI digits
-		dig_n %= f;												// Eliminate the extra carrier so now l contains no_dig digits to add to the string
-																// Add the carrier to the existing number for PI calculate so far.
-		if (carry > 0)
-			{
-			++no_carry;											// Keep count of how many carrier detect
-			for (int i = ss.length(); carry > 0 && i > 0; --i)	// Loop and propagate back the extra carrier to the existing PI digits found so far
-				{												// Never seen more than one loop here but it can handle multiple carry back propagation
-				int new_digit;
-				new_digit = (ss[i - 1] - '0') + carry;			// Calculate new digit
-				carry = new_digit / 10;							// Calculate new carry if any
-				ss[i - 1] = new_digit % 10 + '0';				// Put the adjusted digit back in our PI digit list
-				}
-			}
+		*p = int_precision( 1 );
+		*q = int_precision( 1 );
+		}
+	else
+		{
+		*p = arg[0];
+		*q = arg[1];
+		*q *= int_precision( k );
+		}
+	*b = int_precision( 1 );
+	*a = int_precision( 1 );
+	}
 
-		(void)sprintf(buffer, "%0*lu", no_dig, dig_n);		// Print previous no_dig digits to buffer
-		ss += std::string(buffer);								// Add it to PI string
-		if (first_time == true)
-			ss.insert(1, ".");									// add the decimal pointafter the first digit to create 3.14...
-		acc = acc % f;											// save current no_dig digits and repeat loop
-		e = (unsigned long)acc;
+// sin(u/v) = sum (-1)^k*(u/v)^(2k+1)/(2k+1)!
+static void _float_precision_term_sin( unsigned int k, const int_precision *arg, int_precision *p, int_precision *q, int_precision *b, int_precision *a )
+	{
+	if( k == 0 )
+		{
+		*p = arg[0];
+		*q = arg[1];
+		}
+	else
+		{
+		*p = -arg[2];
+		*q = arg[3];
+		*q *= int_precision( (uint64_t)( 2 * k ) * ( 2 * k + 1 ) );
 		}
+	*b = int_precision( 1 );
+	*a = int_precision( 1 );
+	}
 
-	ss.erase(digits + 1);											// Remove the extra digits that we didnt requested but used as guard digits
-	if (overflow_flag == true)
-		ss = std::string("Overflow:") + ss;						// Set overflow in the return string
-	delete [] a;												// Delete the a[];
-	return ss;													// Return Pi with the number of digits
+// cos(u/v) = sum (-1)^k*(u/v)^(2k)/(2k)!
+static void _float_precision_term_cos( unsigned int k, const int_precision *arg, int_precision *p, int_precision *q, int_precision *b, int_precision *a )
+	{
+	if( k == 0 )
+		{
+		*p = int_precision( 1 );
+		*q = int_precision( 1 );
+		}
+	else
+		{
+		*p = -arg[2];
+		*q = arg[3];
+		*q *= int_precision( (uint64_t)( 2 * k - 1 ) * ( 2 * k ) );
+		}
+	*b = int_precision( 1 );
+	*a = int_precision( 1 );
 	}
 
-/// End Spigot PI
+// atan(u/v) = sum (-1)^k*(u/v)^(2k+1)/(2k+1)
+static void _float_precision_term_atan( unsigned int k, const int_precision *arg, int_precision *p, int_precision *q, int_precision *b, int_precision *a )
+	{
+	if( k == 0 )
+		{
+		*p = arg[0];
+		*q = arg[1];
+		}
+	else
+		{
+		*p = -arg[2];
+		*q = arg[3];
+		}
+	*b = int_precision( (uint64_t)2 * k + 1 );
+	*a = int_precision( 1 );
+	}
 
-///	@author Henrik Vestermark (hve@hvks.com)
-///	@date  29/Jan/2017
-///	@brief 	Calculate transcendetal constant of exp(1)
-///	@return std::string -	return the constant as a standard std::string
-///	@param   "digits"	-	Number of digits
+// atanh(u/v) = sum (u/v)^(2k+1)/(2k+1)
+static void _float_precision_term_atanh( unsigned int k, const int_precision *arg, int_precision *p, int_precision *q, int_precision *b, int_precision *a )
+	{
+	if( k == 0 )
+		{
+		*p = arg[0];
+		*q = arg[1];
+		}
+	else
+		{
+		*p = arg[2];
+		*q = arg[3];
+		}
+	*b = int_precision( (uint64_t)2 * k + 1 );
+	*a = int_precision( 1 );
+	}
+
+// Chudnovsky. 1/pi = 12/640320^(3/2) * sum (-1)^k*(6k)!*(13591409+545140134k)/((3k)!*(k!)^3*640320^(3k))
+// p(k)=-(6k-5)(2k-1)(6k-1) and q(k)=k^3*640320^3/24 is the ratio between two consecutive terms. There is no argument
+static void _float_precision_term_pi( unsigned int k, const int_precision *, int_precision *p, int_precision *q, int_precision *b, int_precision *a )
+	{
+	if( k == 0 )
+		{
+		*p = int_precision( 1 );
+		*q = int_precision( 1 );
+		}
+	else
+		{
+		*p = int_precision( (uint64_t)( 6 * k - 5 ) * ( 2 * k - 1 ) );
+		*p *= int_precision( 6 * k - 1 );
+		p->change_sign();
+		*q = int_precision( (uint64_t)k * k );
+		*q *= int_precision( k );
+		*q *= int_precision( (uint64_t)10939058860032000ULL );
+		}
+	*b = int_precision( 1 );
+	*a = int_precision( (uint64_t)545140134 * k + 13591409 );
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	Binary splitting sum of a series
 ///
 ///	@todo
 ///
 /// Description:
-///
-/// Spigot algorithm for e
-/// From The computer Journal 1968 (A H J Sale) written in Algo 60 and ported with some modification
-/// to c++
-static std::string spigot_e( const int digits)
+///   Keep the binary split sum S of the first terms of a series as the integers P=p(0)...p(n-1), Q=q(0)...q(n-1),
+///   B=b(0)...b(n-1) and T=B*Q*S. The sum of n terms cost O(M(n)log(n)) instead of n full precision divisions
+///   and extend() only sum the new terms and merge them into P, Q, B and T so more digits does not start over
+//
+class _float_precision_series
 	{
-	unsigned int m;
-	unsigned int tmp, carry;
-	double test = (digits+1) * log(10);
-	bool first_time = true;
-	unsigned int *coef;
-	std::string ss("2.");
-	ss.reserve(digits + 16);
-	double xnew, xold;
+	_float_precision_term mTerm;	// The terms of the series
+	int_precision mArg[4];			// Argument u/v of the series as u, v, u^2 and v^2
+	unsigned int mTerms;			// Number of terms summed in mP, mQ, mB and mT
+	int_precision mP, mQ, mB, mT;
 
-	// Stirling approximation of m!~Sqrt(2*pi*digits)(digits/e)^digits.
-	// Taken ln on both side you get: m*(Math.log((m)-1)+0.5*Math.log(2*Math.pi*m);
-	// Use Newton method to find in less that 4-5 iteration
-	for (xold = 5, xnew = 0; ; xold = xnew)
+	// Merge the sum of the terms n1..m-1 in P, Q, B and T with the sum of the terms m..n2-1 in P2, Q2, B2 and T2
+	static void merge( int_precision *P, int_precision *Q, int_precision *B, int_precision *T, const int_precision& P2, const int_precision& Q2, const int_precision& B2, const int_precision& T2 )
 		{
-		double  f = xold*(log(xold) - 1) + 0.5*log(2 * 3.141592653589793 * xold);
-		double f1 = 0.5 / xold + log(xold);
-		xnew = xold - (f - test) / f1;
-		if ((int)ceil(xnew) == (int)ceil(xold))
-			break;
+		int_precision t( *B );
+
+		t *= *P;
+		t *= T2;
+		*B *= B2;
+		*P *= P2;
+		*T *= B2;
+		*T *= Q2;
+		*T += t;
+		*Q *= Q2;
 		}
-	m = (unsigned int)ceil(xnew);
-	if (m < 5)
-		m = 5;
-	coef = new unsigned int[m + 1];
 
-	for (int i = 1; i < digits; ++i, first_time = false)
+	// Sum the terms n1..n2-1 into P, Q, B and T
+	void split( unsigned int n1, unsigned int n2, int_precision *P, int_precision *Q, int_precision *B, int_precision *T ) const
 		{
-		carry = 0;
-		for (int j = m; j >= 2; j--)
+		if( n2 - n1 == 1 )
 			{
-			if (first_time == true)
-				tmp = 10;
-			else
-				tmp = coef[j] * 10;
-			tmp += carry;
-			carry = tmp / (j);
-			coef[j] = tmp % (j);
+			mTerm( n1, mArg, P, Q, B, T );
+			*T *= *P;
 			}
-		ss.append(1, (char)(carry + '0'));
-		}
-	delete [] coef;
-	return ss;
-	}
-
-/// End Spigot e
-
-/// Spigot LN(X/Y) where x and y are integers and x>0 && x>y as conditions
+		else
+			{
+			unsigned int m = n1 + ( n2 - n1 ) / 2;
+			int_precision P2, Q2, B2, T2;
 
-///	@author Henrik Vestermark (hve@hvks.com)
-///	@date  28/Jan/2017
-///	@brief 	Calculate transcendetal constant of ln(x/y)
-///	@return std::string -	return the constant as a standard std::string
-///	@param   "x"	-	The nominator of the number x
-/// @param	 "y"	-	The Denominator of the number x
-///	@param   "digits"	-	Number of digits
-/// @param   "no_dig"	-	Number of digits calculated per loop
-///
-///	@todo
-///
-/// Description:
-///
-/// 64 bit version of spigot algorithm for LN(x/y) fraction
-/// It has automatic 64bit integer overflow detection in which case the result start with the string "Overflow...."
-/// A Column: x-1,x-1,x-1,...,x-1
-/// B Column: x,x,x,x,x,...,x
-/// Initialization values: (x-1)/(x(n+1))...
-/// The function is declare static since it only serve as a sub function for the function _float_table()
-///
-static std::string spigot_lnxy_64(const unsigned int x, const unsigned int y, const int digits, int no_dig = 1)
-	{
-	static unsigned long f_table[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000 };
-	bool first_time = true;				// First iteration of the algorithm
-	bool overflow_flag = false;			// 64bit integer overflow flag
-	char buffer[32];
-	std::string ss;						// The std::string that holds the ln(x)
-	int dig;
-	unsigned int car;
-	unsigned int no_terms;				// No of terms to complete as a function of digits
-	unsigned long f;					// New base 1 decimal digits at a time
-	unsigned long dig_n;				// dig_n holds the next no_dig digit to add
-	uint64_t carry;
-	uint64_t tmp_n, tmp_dn;
-	ss.reserve(digits + 16);
-	int factor;
-
-	if (x < y || x < 1)
-		{ throw float_precision::domain_error(); }
+			split( n1, m, P, Q, B, T );
+			split( m, n2, &P2, &Q2, &B2, &T2 );
+			merge( P, Q, B, T, P2, Q2, B2, T2 );
+			}
+		}
 
-	if (no_dig > 8) no_dig = 8;			// Ensure no_dig<=8
-	if (no_dig < 1) no_dig = 1;			// Ensure no_dig>0
-	// Since we do it in trunks of no_dig digits at a time we need to ensure digits is divisble with no_dig.
-	dig = (digits / no_dig + (digits%no_dig>0 ? 1 : 0)) * no_dig;
-	dig += no_dig;						// Extra guard digits
-										// Calculate the number of terms needed
-	factor = (int)ceil(10 * log(0.5) / log((double)(x - y) / (double)x));
-	no_terms = (unsigned int)(factor * dig / 3 + 3);
-	// Allocate the needed accumulators
-	uint64_t *acc_n = new uint64_t[no_terms + 1];
-	uint64_t *acc_dn = new uint64_t[no_terms + 1];
-	f = f_table[no_dig];				// Load the initial f
-	carry = 0;							// Set carry to 0
-	//Loop for each no_dig
-	for (int i = dig; i >= 0 && overflow_flag == false; i -= first_time == true ? 1 : no_dig, first_time = false)
-		{
-		// Calculate new number of terms needed
-		no_terms = (unsigned int)(factor * i / 3 + 3);
-		// Loop for each no_terms
-		for (int j = no_terms; j>0 && overflow_flag == false; --j)
+	public:
+		_float_precision_series( _float_precision_term t, const int_precision& u = int_precision( 1 ), const int_precision& v = int_precision( 1 ) ) : mTerm(t), mTerms(0), mP(1), mQ(1), mB(1), mT(0)
 			{
-			if (first_time == true)
-				{// Calculate the initialize value
-				tmp_dn = (j + 1) * x;
-				tmp_n = (x - y);
-				}
-			else
-				{
-				tmp_n = acc_n[j];
-				tmp_dn = acc_dn[j];
-				}
-			if (tmp_n > (ULLONG_MAX) / f)
-				overflow_flag = true;
-			tmp_n *= f;		// Scale it
-			// Check for 64bit overflow. Not very likely
-			if (carry > 0 && tmp_dn > (ULLONG_MAX - tmp_n) / carry)
-				overflow_flag = true;
-			tmp_n += carry * tmp_dn;
-			carry = (tmp_n / (x * tmp_dn));
-			carry *= (x - y);
-			acc_n[j] = tmp_n % (tmp_dn * x);
-			acc_dn[j] = tmp_dn;
+			mArg[0] = u;
+			mArg[1] = v;
+			mArg[2] = u * u;
+			mArg[3] = v * v;
 			}
 
-		if (first_time == true)
+		// Sum the series to at least n terms
+		void extend( unsigned int n )
 			{
-			tmp_n = (x - y) * f;
-			if (carry > 0 && tmp_n > (ULLONG_MAX - carry * x))
-				overflow_flag = true;
+			if( n > mTerms )
+				{
+				int_precision P2, Q2, B2, T2;
 
-			acc_n[0] = (tmp_n + carry*x);
-			acc_dn[0] = x;
-			dig_n = (unsigned)(acc_n[0] / (f*acc_dn[0]));
+				split( mTerms, n, &P2, &Q2, &B2, &T2 );
+				merge( &mP, &mQ, &mB, &mT, P2, Q2, B2, T2 );
+				mTerms = n;
+				}
 			}
-		else
+
+		// Return S*10^digits or 10^digits/S truncated to an integer
+		int_precision sum( unsigned int digits ) const
 			{
-			if (acc_n[0] > (ULLONG_MAX - carry * acc_dn[0]) / f)
-				overflow_flag = true;
-			dig_n = (unsigned)((acc_n[0] * f + carry * acc_dn[0]) / (f*acc_dn[0]));
+			int_precision n( mT ), d( mB );
+
+			if( mT == int_precision( 0 ) )
+				return mT;
+			n.pointer()->append( digits, (char)ICHARACTER( 0 ) );
+			d *= mQ;
+			n /= d;
+			return n;
 			}
-		car = (unsigned)(dig_n / f);
-		dig_n %= f;
-		// Add the carry to the existing number for digits calculate so far.
-		if (car > 0)
+		int_precision inverse( unsigned int digits ) const
 			{
-			for (int j = ss.length(); car > 0 && j > 0; --j)
-				{
-				int dd;
-				dd = (ss[j - 1] - '0') + car;
-				car = dd / 10;
-				ss[j - 1] = dd % 10 + '0';
-				}
+			int_precision n( mB ), d( mT );
+
+			n *= mQ;
+			n.pointer()->append( digits, (char)ICHARACTER( 0 ) );
+			n /= d;
+			return n;
 			}
-		(void)sprintf(buffer, "%0*lu", first_time == true ? 1 : no_dig, dig_n);
-		ss += std::string(buffer);
-		if (first_time == true)
-			acc_n[0] %= f*acc_dn[0];
-		else
+	};
+
+// Return the integer i scaled by 10^-digits with precision significant digits
+static float_precision _float_precision_scale( const int_precision& i, unsigned int digits, unsigned int precision )
+	{
+	float_precision f( i, precision, ROUND_NEAR );
+
+	f.exponent( f.exponent() - (int)digits );
+	return f;
+	}
+
+// Return x*10^digits truncated to an integer
+static int_precision _float_precision_fixed( const float_precision& x, unsigned int digits )
+	{
+	float_precision f( x );
+
+	if( f.exponent() + (int)digits < 0 )
+		return int_precision( 0 );
+	f.exponent( f.exponent() + (int)digits );
+	return f.to_int_precision();
+	}
+
+// Return 10^n
+static int_precision _float_precision_pow10( unsigned int n )
+	{
+	std::string s( n + 1, (char)ICHARACTER( 0 ) );
+
+	s[0] = (char)ICHARACTER( 1 );
+	return int_precision( s );
+	}
+
+// Return the decimals from+1..to of the fixed point digits s with decimals decimals as an integer. from=0 include the integer part
+static int_precision _float_precision_decimals( const std::string& s, unsigned int decimals, unsigned int from, unsigned int to )
+	{
+	size_t intlen = s.length() - decimals;
+	size_t i = s.find_first_not_of( (char)ICHARACTER( 0 ), from == 0 ? 0 : intlen + from );
+
+	if( i == std::string::npos || i >= intlen + to )
+		return int_precision( 0 );
+	return int_precision( s.substr( i, intlen + to - i ) );
+	}
+
+// Number of terms of the series for exp(x) with |x|<10^lx before the terms are less than 10^-digits
+static unsigned int _float_precision_exp_terms( double lx, unsigned int digits )
+	{
+	unsigned int n;
+	double t;	// log10 of the term
+
+	for( n = 1, t = 0; t > -(double)digits || n < 10; ++n )
+		t += lx - log10( (double)n );
+	return n;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	exp(x) with the bit burst algorithm
+///	@return 	float_precision	-	exp(x)
+///	@param   "x"	-	The argument. |x|<10
+///	@param   "digits"	-	Number of decimals to use
+///
+///	@todo
+///
+/// Description:
+///   Split x into x0+x1+x2... where x0 is the integer part and the first 2 decimals and xj is the decimals 2^j+1..2^(j+1)
+///   exp(x)=exp(x0)*exp(x1)*... and each exp(xj) is a binary split series with the rational argument u/10^(2^(j+1)).
+///   Since |xj|<10^-(2^j) the series only need about digits/2^j terms so the total cost is O(M(n)log(n)^2)
+//
+static float_precision _float_precision_exp_burst( const float_precision& x, unsigned int digits )
+	{
+	std::string s = *_float_precision_fixed( abs( x ), digits ).pointer();
+	float_precision res( 1, digits, ROUND_NEAR );
+	int_precision u;
+
+	if( s.length() < digits + 1 )
+		s.insert( (size_t)0, digits + 1 - s.length(), (char)ICHARACTER( 0 ) );
+	for( unsigned int from = 0, to = 2; from < digits; from = to, to *= 2 )
+		{
+		if( to > digits )
+			to = digits;
+		u = _float_precision_decimals( s, digits, from, to );
+		if( u == int_precision( 0 ) )
+			continue;
+		if( x.sign() < 0 )
+			u.change_sign();
+		_float_precision_series e( _float_precision_term_exp, u, _float_precision_pow10( to ) );
+		e.extend( _float_precision_exp_terms( from == 0 ? 1 : -(double)from, digits ) );
+		res *= _float_precision_scale( e.sum( digits ), digits, digits );
+		}
+
+	return res;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	sin(x) and cos(x) with the bit burst algorithm
+///	@return 	void	-
+///	@param   "x"	-	The argument. |x|<10
+///	@param   "digits"	-	Number of decimals to use
+///	@param   "sx"	-	sin(x)
+///	@param   "cx"	-	cos(x)
+///
+///	@todo
+///
+/// Description:
+///   Same split of x as _float_precision_exp_burst(). sin(xj) and cos(xj) are binary split series and
+///   they are combined with sin(a+b)=sin(a)cos(b)+cos(a)sin(b) and cos(a+b)=cos(a)cos(b)-sin(a)sin(b)
+//
+static void _float_precision_sincos_burst( const float_precision& x, unsigned int digits, float_precision *sx, float_precision *cx )
+	{
+	std::string s = *_float_precision_fixed( abs( x ), digits ).pointer();
+	float_precision sa( 0, digits, ROUND_NEAR ), ca( 1, digits, ROUND_NEAR ), sb( 0, digits, ROUND_NEAR ), cb( 0, digits, ROUND_NEAR ), t( 0, digits, ROUND_NEAR );
+	int_precision u, v;
+	unsigned int terms;
+
+	if( s.length() < digits + 1 )
+		s.insert( (size_t)0, digits + 1 - s.length(), (char)ICHARACTER( 0 ) );
+	for( unsigned int from = 0, to = 2; from < digits; from = to, to *= 2 )
+		{
+		if( to > digits )
+			to = digits;
+		u = _float_precision_decimals( s, digits, from, to );
+		if( u == int_precision( 0 ) )
+			continue;
+		if( x.sign() < 0 )
+			u.change_sign();
+		v = _float_precision_pow10( to );
+		terms = _float_precision_exp_terms( from == 0 ? 1 : -(double)from, digits ) / 2 + 1;
+		_float_precision_series sin_series( _float_precision_term_sin, u, v ), cos_series( _float_precision_term_cos, u, v );
+		sin_series.extend( terms );
+		cos_series.extend( terms );
+		sb = _float_precision_scale( sin_series.sum( digits ), digits, digits );
+		cb = _float_precision_scale( cos_series.sum( digits ), digits, digits );
+		t = sa * cb + ca * sb;
+		ca = ca * cb - sa * sb;
+		sa = t;
+		}
+
+	if( sx != NULL )
+		*sx = sa;
+	if( cx != NULL )
+		*cx = ca;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	atan(x) with the bit burst algorithm
+///	@return 	float_precision	-	atan(x)
+///	@param   "x"	-	The argument. |x|<0.1
+///	@param   "digits"	-	Number of decimals to use
+///
+///	@todo
+///
+/// Description:
+///   Take r0 as x with 2 decimals and sum the binary split series of atan(r0). The rest of the angle is
+///   atan(x)-atan(r0)=atan((x-r0)/(1+x*r0)) which is less than 10^-2 and the next step take 4 decimals of it and so on
+//
+static float_precision _float_precision_atan_burst( const float_precision& x, unsigned int digits )
+	{
+	float_precision res( 0, digits, ROUND_NEAR ), y( 0, digits, ROUND_NEAR ), r( 0, digits, ROUND_NEAR );
+	const float_precision c0( 0 ), c1( 1 );
+	int_precision u;
+
+	y = x;
+	for( unsigned int to = 2; y != c0 && y.exponent() > -(int)digits; to *= 2 )
+		{
+		if( to > digits )
+			to = digits;
+		u = _float_precision_fixed( y, to );
+		if( u != int_precision( 0 ) )
 			{
-			acc_n[0] = acc_n[0] * f + carry *acc_dn[0];
-			acc_n[0] %= f  * acc_dn[0];
+			double lx = log10( fabs( (double)y ) );
+			_float_precision_series a( _float_precision_term_atan, u, _float_precision_pow10( to ) );
+			a.extend( (unsigned int)( digits / ( -2 * lx ) ) + 2 );
+			res += _float_precision_scale( a.sum( digits ), digits, digits );
+			r = _float_precision_scale( u, to, digits );
+			y = ( y - r ) / ( c1 + y * r );
 			}
-		carry = 0;
+		if( to == digits )
+			break;
 		}
 
-	ss.insert(1, ".");// add a . come after the first digit to create 2.30...
-	if (overflow_flag == false)
-		ss.erase(digits + 1); // Remove the extra digits that we didnt requested.
-	else
-		ss = std::string("Overflow:") + ss;
-
-	delete[] acc_n;
-	delete[] acc_dn;
-	return ss;
+	return res;
 	}
 
-/// End Spigot LN(X/Y)
+//////////////////////////////////////////////////////////////////////////////////////
+///
+/// FLOAT PRECISION
+///    Universal Constants LN2, LN10, e and PI
+///
+//////////////////////////////////////////////////////////////////////////////////////
+
+// The cached constants in the order of enum table_type with the number of significant digits they hold
+class _float_table_cache
+	{
+	public:
+		float_precision value[4];
+		unsigned int digits[4];
+
+		_float_table_cache() { for( int i = 0; i < 4; ++i ) digits[i] = 0; }
+	};
+
+static const char *_float_table_name[] = { "ln2", "ln10", "pi", "e" };
+
+static _float_table_cache& _float_table_constants()
+	{
+	static _float_table_cache cache;
+	return cache;
+	}
 
 ///	@author Henrik Vestermark (hve@hvks.com)
 ///	@date  1/24/2005
@@ -4230,101 +7865,188 @@ static std::string spigot_lnxy_64(const unsigned int x, const unsigned int y, co
 ///   If a higher precision is requested we create it and return otherwise
 ///   we just the "constant" at a higher precision which eventually will be
 ///   rounded to the destination variables precision
+///   The constants are binary split sums of the series
+///		e = sum 1/k!
+///		ln(2) = 18*atanh(1/26)-2*atanh(1/4801)+8*atanh(1/8749)
+///		ln(10) = 3*ln(2)+2*atanh(1/9)
+///		PI = 426880*sqrt(10005)/S where S is the Chudnovsky series
+///   that keep the sum of the terms so far. A higher precision only sum the new terms and the cache grows by at
+///   least half its size at a time so creeping precision requests does not redo the final division every time
 //
 float_precision _float_table( enum table_type tt, unsigned int precision )
    {
-   static float_precision ln2( 0, 0, ROUND_NEAR );
-   static float_precision ln10( 0, 0, ROUND_NEAR );
-   static float_precision pi( 0, 0, ROUND_NEAR );
-   static float_precision e( 0, 0, ROUND_NEAR);
-   const float_precision c1(1);
-   float_precision res(0, precision, ROUND_NEAR);
-
-   switch( tt )
+   static _float_precision_series e( _float_precision_term_exp );
+   static _float_precision_series atanh26( _float_precision_term_atanh, 1, 26 ), atanh4801( _float_precision_term_atanh, 1, 4801 ), atanh8749( _float_precision_term_atanh, 1, 8749 );
+   static _float_precision_series atanh9( _float_precision_term_atanh, 1, 9 );
+   static _float_precision_series pi( _float_precision_term_pi );
+   _float_table_cache& cache = _float_table_constants();
+   float_precision res( 0, precision, ROUND_NEAR );
+
+   if( cache.digits[tt] < precision )
       {
-	  case _EXP1:
-	      if (e.precision() >= precision)
-		     res = e;
-	      else
-		     {// Using Spigot algorithm for exp(1) Calculation
-		     std::string ss;
-		     unsigned int prec = std::max(20U, precision + 2);
-		     e.precision(prec);
-		     ss = spigot_e( prec );				// The result as a string in BASE_10
-		     e = float_precision(ss, prec);		// Convert to float_precision
-		     e.precision(std::max(20U, precision));
-		     res = e;
-	         }
-		  break;
-      case _LN2:
-		  if (ln2.precision() >= precision)
-			  res = ln2;
-		  else
-			 { // Using Spigot algorithm for LN2 Calculation
-			 std::string ss;
-			 unsigned int prec = std::max(20U, precision+2);
-			 ln2.precision( prec );
-			 ss = spigot_lnxy_64(2, 1, prec, 4);	// The result as a string in BASE_10
-			 ln2 = float_precision(ss, prec);		// Convert to float_precision
-			 ln2.precision(std::max(20U, precision));
-			 res = ln2;								// Save the result
-			 }
-		  break;
-      case _LN10:
-         if( ln10.precision() >= precision )
-            res = ln10;
-         else
-			{ // Using Spigot Algorithm for LN10. LN(10)=3*ln(2)+ln(10/8)
-			std::string ss;
-			unsigned int prec=std::max(20U, precision + 2);
-			ln10.precision(prec);
-			ss = spigot_lnxy_64(2, 1, prec, 4);		// The result as a string in BASE_10
-			ln10 = float_precision(ss, prec);		// Convert to float_precision
-			ln10 *= float_precision(3);
-			ss = spigot_lnxy_64(10, 8, prec, 4);	// The result as a string in BASE_10
-			ln10 += float_precision(ss, prec);		// Convert and add to float_precision ln10
-			ln10.precision(std::max(20U, precision));
-			res = ln10;								// Save the result
-			}
-		 break;
-      case _PI:
-         if( pi.precision() > precision )
-			res = pi;
-		 else
-			{  // Using Brent-Salamin method
-			unsigned int min_precision = precision + 5 + (F_RADIX == BASE_2 ? 5 : 0);
-			const int limit = -(int)(precision + 2);
-			const float_precision c0(0), c2(2), c05(0.5);
-			float_precision a(1, min_precision), b(2, min_precision), sum(0.5, min_precision);
-			float_precision ak(0, min_precision), bk(0, min_precision), ck(1, min_precision);
-			float_precision ab(0, min_precision), asq(0, min_precision );
-			float_precision pow2(1, precision);
-
-			if (F_RADIX < BASE_10 && min_precision < PRECISION) min_precision = PRECISION;
-			pi.precision(min_precision);
-			b = c1 / sqrt(b);
-			for (; ck != c0 && ck.exponent()>limit; )
-				{
-				ak = c05*(a + b);
-				ab = a * b;
-				bk = sqrt(ab);
-				asq = ak * ak;
-				ck = asq - ab;
-				pow2 *= c2;
-				sum -= pow2*ck;
-				a = ak; b = bk;
-				}
-			pi = c2 * asq / sum;
-			res = pi;
-			// Round and store it
-			pi.precision(precision);
-			}
-		 break;
+      unsigned int prec = std::max( 20U, precision + 2 );
+      unsigned int work, terms;
+      double digits;
+      int_precision s;
+
+      if( prec < cache.digits[tt] + cache.digits[tt] / 2 )
+         prec = cache.digits[tt] + cache.digits[tt] / 2;
+      work = prec + 10;		// Guard digits for the truncated sums
+      float_precision v( 0, work, ROUND_NEAR );
+      switch( tt )
+         {
+         case _EXP1:
+            // The error after n terms is less than 1/n! so sum until log10(n!) exceed the digits needed
+            for( terms = 1, digits = 0; digits < work + 1; ++terms )
+               digits += log10( (double)terms );
+            e.extend( terms );
+            v = _float_precision_scale( e.sum( work ), work, work );
+            break;
+         case _LN2:
+         case _LN10:
+            atanh26.extend( (unsigned int)( work / ( 2 * log10( 26.0 ) ) ) + 2 );
+            atanh4801.extend( (unsigned int)( work / ( 2 * log10( 4801.0 ) ) ) + 2 );
+            atanh8749.extend( (unsigned int)( work / ( 2 * log10( 8749.0 ) ) ) + 2 );
+            s = int_precision( 18 ) * atanh26.sum( work );
+            s -= int_precision( 2 ) * atanh4801.sum( work );
+            s += int_precision( 8 ) * atanh8749.sum( work );
+            if( tt == _LN10 )
+               {
+               atanh9.extend( (unsigned int)( work / ( 2 * log10( 9.0 ) ) ) + 2 );
+               s *= int_precision( 3 );
+               s += int_precision( 2 ) * atanh9.sum( work );
+               }
+            v = _float_precision_scale( s, work, work );
+            break;
+         case _PI:
+            // Each term add a little more than 14 digits
+            pi.extend( work / 14 + 2 );
+            s = pi.inverse( work );
+            s *= int_precision( 426880 );
+            v = _float_precision_scale( s, work, work );
+            v *= sqrt( float_precision( 10005, work, ROUND_NEAR ) );
+            break;
+         }
+      cache.value[tt].mode( ROUND_NEAR );
+      cache.value[tt].precision( prec );
+      cache.value[tt] = v;
+      cache.digits[tt] = prec;
       }
+   res = cache.value[tt];
 
    return res;
    }
 
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_float_table_load
+///	@return 	bool	-	true if the file could be read and all the constants in it are valid otherwise false
+///	@param   "file"	-	The file with the constants
+///
+///	@todo
+///
+/// Description:
+///   Load the constants of _float_table() from a file written by _float_table_save()
+///   Each line holds the name of the constant, the number of significant digits and the value.
+///   A constant is only replaced if the file hold more digits than the cache.
+///   Every constant is checked against the first TABLE_CHECK_DIGITS digits computed by _float_table() and the value must
+///   hold the digits it claim except for trailing zeros. If a line can not be read or any constant fail the check the whole
+///   file is ignored so a corrupt file can neither throw nor replace a constant with a wrong value
+//
+bool _float_table_load( const char *file )
+	{
+	static const unsigned int TABLE_CHECK_DIGITS = 50;
+	static const unsigned int TABLE_TRAILING_ZEROS = 20;	// More trailing zeros than this is taken as a truncated value
+	_float_table_cache& cache = _float_table_constants();
+	FILE *fp = fopen( file, "r" );
+	float_precision loaded[4];
+	unsigned int found[4] = { 0, 0, 0, 0 };
+	char name[16];
+	unsigned int digits, k;
+	std::string value;
+	int c, n, tt;
+	bool ok = true;
+
+	if( fp == NULL )
+		return false;
+	try
+		{
+		while( ok && ( n = fscanf( fp, "%15s %u ", name, &digits ) ) == 2 )
+			{
+			value.clear();
+			for( c = fgetc( fp ); c != EOF && c != '\n'; c = fgetc( fp ) )
+				value += (char)c;
+			for( tt = _LN2; tt <= _EXP1 && strcmp( name, _float_table_name[tt] ) != 0; ++tt )
+				;
+			if( tt > _EXP1 || found[tt] != 0 || digits == 0 )
+				{// Unknown or repeated constant
+				ok = false;
+				break;
+				}
+			loaded[tt].precision( digits );
+			loaded[tt] = float_precision( value, digits, ROUND_NEAR );
+			if( loaded[tt].ref_mantissa()->length() + TABLE_TRAILING_ZEROS < digits )
+				ok = false;
+			found[tt] = digits;
+			}
+		if( ok && n != EOF )
+			ok = false;
+		for( tt = _LN2; ok && tt <= _EXP1; ++tt )
+			if( found[tt] != 0 )
+				{// The difference to the computed prefix must be less than one unit in the last digit checked
+				float_precision ref( 0, TABLE_CHECK_DIGITS + 10 ), d( 0, TABLE_CHECK_DIGITS + 10 ), eps( "1", TABLE_CHECK_DIGITS + 10 );
+
+				k = std::min( found[tt], TABLE_CHECK_DIGITS );
+				ref = _float_table( (enum table_type)tt, TABLE_CHECK_DIGITS + 10 );
+				d = loaded[tt] - ref;
+				eps.exponent( ref.exponent() - (int)k + 1 );
+				if( abs( d ) > eps )
+					ok = false;
+				}
+		}
+	catch( ... )
+		{// A value that can not be parsed or a number of digits that can not be allocated
+		ok = false;
+		}
+	fclose( fp );
+	if( !ok )
+		return false;
+	for( tt = _LN2; tt <= _EXP1; ++tt )
+		if( found[tt] > cache.digits[tt] )
+			{
+			cache.value[tt].mode( ROUND_NEAR );
+			cache.value[tt].precision( found[tt] );
+			cache.value[tt] = loaded[tt];
+			cache.digits[tt] = found[tt];
+			}
+	return true;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_float_table_save
+///	@return 	bool	-	true if the file could be written otherwise false
+///	@param   "file"	-	The file to write
+///
+///	@todo
+///
+/// Description:
+///   Save the constants computed by _float_table() in the format _float_table_load() read
+///   so the next run does not have to compute them again
+//
+bool _float_table_save( const char *file )
+	{
+	_float_table_cache& cache = _float_table_constants();
+	FILE *fp = fopen( file, "w" );
+
+	if( fp == NULL )
+		return false;
+	for( int tt = _LN2; tt <= _EXP1; ++tt )
+		if( cache.digits[tt] > 0 )
+			fprintf( fp, "%s %u %s\n", _float_table_name[tt], cache.digits[tt], cache.value[tt].toString().c_str() );
+	return fclose( fp ) == 0;
+	}
+
 //////////////////////////////////////////////////////////////////////////////////////
 ///
 /// FLOAT PRECISION FUNCTIONS
@@ -4335,6 +8057,93 @@ float_precision _float_table( enum table_type tt, unsigned int precision )
 
 
 
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 		Calculate log(x) with the arithmetic geometric mean
+///	@return 	   float_precision -	Return log(x)
+///	@param      "x"	-	   The argument. x>0
+///	@param      "digits"	-	   Number of digits to use
+///
+///	@todo
+///
+/// Description:
+///   log(s)=PI/(2*AGM(1,4/s)) with a relative error O(1/s^2). x is scaled to s=x*10^m with s>10^(digits/2) so
+///   log(x)=PI/(2*AGM(1,4/s))-m*ln(10). The AGM converge quadratically so it only need about 2*log2(digits)
+///   steps of a sqrt() and a multiplication
+//
+static float_precision _float_precision_log_agm( const float_precision& x, unsigned int digits )
+   {
+   unsigned int work;
+   int m;
+   double lx = log( fabs( (double)( x - float_precision( 1 ) ) ) + 1e-300 );
+   float_precision a, b, t, s, res;
+   const float_precision c05( 0.5 ), c4( 4 );
+
+   // The subtraction of m*ln(10) cancel the leading digits when x is close to 1 and there is log10(m) digits more to the left
+   work = digits + 10 + (unsigned int)log10( (double)digits + 1 );
+   if( lx < 0 )
+      work += (unsigned int)( -lx / log( 10.0 ) );
+   m = (int)( work / 2 ) + 1 - x.exponent();
+   s.precision( work );
+   s = x;
+   s.exponent( s.exponent() + m );
+   a.precision( work );
+   b.precision( work );
+   t.precision( work );
+   a = float_precision( 1, work );
+   b = c4 / s;
+   for( ;; )
+      {
+      t = a - b;
+      if( t.sign() == 0 || t == float_precision( 0 ) || t.exponent() < a.exponent() - (int)work / 2 - 1 )
+         break;
+      t = a + b;
+      t *= c05;
+      b *= a;
+      b = sqrt( b );
+      a = t;
+      }
+   a += b;
+   a *= c05;
+   res.precision( work );
+   res = _float_table( _PI, work );
+   res /= a + a;
+   res -= float_precision( m ) * _float_table( _LN10, work + 10 );
+   return res;
+   }
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 		Calculate exp(x) with Newton iterations on log()
+///	@return 	   float_precision -	Return exp(x)
+///	@param      "x"	-	   The argument. 0<=x<ln(10)
+///	@param      "digits"	-	   Number of digits to use
+///
+///	@todo
+///
+/// Description:
+///   Yn=Y+Y(x-log(Y)) doubling the precision each step from the double seed so the cost is a small
+///   constant times one log() at full precision
+//
+static float_precision _float_precision_exp_newton( const float_precision& x, unsigned int digits )
+   {
+   std::vector<unsigned int> steps;
+   float_precision y, r;
+
+   y = float_precision( exp( (double)x ) );
+   _float_precision_newton_steps( digits, &steps );
+   for( int i = (int)steps.size() - 1; i >= 0; --i )
+      {
+      y.precision( steps[i] );
+      r.precision( steps[i] );
+      r = x;
+      r -= log( y );
+      r *= y;
+      y += r;
+      }
+   return y;
+   }
+
 /// Experimental new exp() using sinh() and sqrt()
 ///	@author Henrik Vestermark (hve@hvks.com)
 ///	@date  8/1/2013
@@ -4348,8 +8157,10 @@ float_precision _float_table( enum table_type tt, unsigned int precision )
 ///   Use a the identity that exp(x)=sinh(x)+sqrt(1+sinh(x)^2)
 ///	  This has proven to be faster than the standard taylor series for exp()
 ///   exp(x) == 1 + x + x^2/2!+x^3/3!+....
+///   From precision_ctrl.series_threshold() digits the series is summed with binary splitting instead
+///   and from precision_ctrl.exp_newton_threshold() digits it is Newton iterations on log()
 //	  A test i smade for x is an integer in which case we do pow(e,x) which is more than 400 times faster
-//    sine e is calculated using the spigot algorithm using pure 64bit integer arithmetic
+//    sine e is taken from the constant table _float_table()
 //
 float_precision exp( const float_precision& x )
    {
@@ -4358,6 +8169,25 @@ float_precision exp( const float_precision& x )
    const float_precision c1(1);
 
    precision = x.precision()+2;
+   if( F_RADIX == BASE_10 && precision >= precision_ctrl.series_threshold() )
+      {// exp(x)=10^n*exp(r) with n=floor(x/ln(10)) and 0<=r<ln(10). exp(r) is a binary split series
+      unsigned int work = precision + 10 + ( x.exponent() > 0 ? x.exponent() : 0 );
+      float_precision ln10( _float_table( _LN10, work ) ), r( 0, work ), n( 0, work );
+
+      r = x;
+      n = floor( r / ln10 );
+      r -= n * ln10;
+      v.precision( work );
+      if( precision >= precision_ctrl.exp_newton_threshold() )
+         v = _float_precision_exp_newton( r, work );
+      else
+         v = _float_precision_exp_burst( r, work );
+      v.exponent( v.exponent() + (int)n );
+      v.mode( x.mode() );
+      v.precision( x.precision() );
+      return v;
+      }
+
    v.precision( precision );
    v = x;
    if( v.sign() < 0 )
@@ -4399,6 +8229,8 @@ float_precision exp( const float_precision& x )
 ///   Equivalent with the same standard C function call
 ///   ln(x) == 2( z + z^3/3 + z^5/5 ...
 ///   z = (x-1)/(x+1)
+///   From precision_ctrl.agm_threshold() digits it use the arithmetic geometric mean. A binary split atanh series
+///   is not used since it is slower than the arithmetic geometric mean at every precision
 //
 float_precision log( const float_precision& x )
    {
@@ -4417,6 +8249,14 @@ float_precision log( const float_precision& x )
    z = x;
    expo = z.exponent();
    z.exponent( 0 );
+   if( F_RADIX == BASE_10 && precision >= precision_ctrl.agm_threshold() )
+      {
+      res.precision( precision );
+      res = _float_precision_log_agm( x, precision );
+      res.mode( x.mode() );
+      res.precision( x.precision() );
+      return res;
+      }
    // Check for augument reduction and increase precision if necessary
    zd=PLOG10( precision );
    zd *= zd;
@@ -4658,7 +8498,7 @@ float_precision fmod( const float_precision& x, const float_precision& y )
 float_precision floor( const float_precision& x )
    {
    float_precision f;
-   unsigned int exponent = 1 + x.exponent();
+   int exponent = 1 + x.exponent();
 
     if( F_RADIX < BASE_10 )
         {
@@ -4704,7 +8544,7 @@ float_precision floor( const float_precision& x )
 float_precision ceil( const float_precision& x )
    {
    float_precision f;
-   unsigned int exponent = 1 + x.exponent();
+   int exponent = 1 + x.exponent();
 
     if( F_RADIX < BASE_10 )
         {
@@ -4849,11 +8689,11 @@ float_precision frexp( float_precision& x, int *expptr )
 /// Description:
 ///   nroot(V)
 ///   The nth root of x^(1/n) No Equivalent standard C function call
-///   Seperate exponent. e.g. nroot(V*10^x)=10^x/2*nroot(V)
-///   Un=U(1/n)(n+1-VU^n)
+///   Seperate exponent. e.g. nroot(V*10^x)=10^(x/n)*nroot(V*10^(x%n))
+///   Un=U+U(1-VU^n)/n
 ///   Then Un == 1/nroot(V). and nroot(V) = 1/Un
-/// The function has been improved using Newton with iterative deepening creating
-///	a speed up with a factor of 3 over the classic Newton method.
+///   Each iteration double the number of correct digits so it is done at twice the precision of the previous
+///   starting from the double seed.
 /// This is a much much faster option instead of the traditional pow() function x^y
 /// and that is why it has been added as a separate function
 //
@@ -4861,79 +8701,70 @@ float_precision nroot(const float_precision& x, unsigned int n)
 	{
 	const unsigned int extra = 2;
 	unsigned int precision;
-	unsigned int digits;
-	int expo, expo_sq;
-	double fv;
-	float_precision r, u, v, tmp, fn(n);
+	int expo, expo_n, i, imax;
+	double fv, dv;
+	float_precision r, u, v, fn;
 	const float_precision c0(0), c1(1);
-	std::string::reverse_iterator rpos;
+	std::vector<unsigned int> steps;
+	std::string::iterator pos;
 
 	if (x == c0 || x == c1 || n == 1)
 		return x;
-	if (x.sign() < 0)
+	if (x.sign() < 0 || n == 0)
 		{ throw float_precision::domain_error(); }
+	if (n == 2)
+		return sqrt(x);
 	precision = x.precision();
 	v.precision(precision + extra);
 	v = x;
 	expo = v.exponent();
-	expo_sq = expo / 2;
-	v.exponent(expo - 2 * expo_sq);
-	r.precision(precision + extra); // Do iteration using 2 digits higher precision
-	u.precision(precision + extra);
-	fn.precision(precision + extra);
+	expo_n = expo >= 0 ? expo / (int)n : -(int)( ( -expo + n - 1 ) / n );	// Round down so 0<=expo-n*expo_n<n
+	v.exponent(0);
 
 	// Get a initial guess using ordinary floating point
-	rpos = v.ref_mantissa()->rbegin();
-	fv = FDIGIT(*rpos);
-	for (rpos++; rpos + 1 != v.ref_mantissa()->rend(); rpos++)
+	pos = v.ref_mantissa()->begin();
+	fv = FDIGIT(*pos);
+	imax = digits_to_check();
+	for (i = 1, dv = 1.0, ++pos; i < imax && pos != v.ref_mantissa()->end(); ++pos, ++i)
 		{
-		fv *= (double)1 / (double)F_RADIX;
-		fv += FDIGIT(*rpos);
+		dv /= (double)F_RADIX;
+		fv += FDIGIT(*pos) * dv;
 		}
-	if (expo - 2 * expo_sq > 0)
-		fv *= (double)F_RADIX;
-	else
-		if (expo - 2 * expo_sq < 0)
-			fv /= (double)F_RADIX;
-	fv = pow(fv, 1.0 / n);  // set the initial guess with at approx 16 correct digits
-	fv = 1 / fv;
+	v.exponent(expo - (int)n * expo_n);
+	// 1/nroot(fv*F_RADIX^(expo-n*expo_n)) with approx 16 correct digits. Logarithms avoid overflow for large n
+	fv = exp( -( log(fv) + (double)(expo - (int)n * expo_n) * log((double)F_RADIX) ) / n );
 
-	tmp.precision(precision+1);
 	u = float_precision(fv);
-	fn = 1 / fn;
-	// Now iterate using Netwon  Un=U*(-VU^n+(n+1))/n
-	for (digits = min((unsigned)32, precision); ; digits = min(precision + extra, digits * 2))
+	fn.precision(precision + extra);
+	fn = _float_precision_inverse(float_precision(n, precision + extra));
+	// Now iterate using Netwon Un=U+U(1-VU^n)/n doubling the precision each step
+	_float_precision_newton_steps(precision + extra, &steps);
+	for (i = (int)steps.size() - 1; i >= 0; --i)
 		{
-		// Increase precision by a factor of two
-		r.precision(digits);
-		u.precision(digits);
+		r.precision(steps[i]);
+		u.precision(steps[i]);
 		float_precision p(u);
-		float_precision res(1, digits);
+		float_precision res(1, steps[i]);
 		// DO U^N
-		for (int i = n; i > 0; i >>= 1)
+		for (unsigned int j = n; j > 0; j >>= 1)
 			{
-			if ((i & 0x1) != 0)
+			if ((j & 0x1) != 0)
 				res *= p;  // Odd
-			if (i>1)
+			if (j>1)
 				p *= p;
 			}
 		// Notice V is the original number to nroot which has the full precision
 		// so we start by assigning it to r, rounding it to the precision of r
 		r = v;							// V
 		r *= res;						// VU^n
-		r = float_precision(n + 1) - r; // (n+1)-VU^n
-		r *= fn;						// (-VU^n+(n+1))/n
-		u *= r;							// U=U*(-VU^n+(n+1))/n
-		if (digits == precision + extra) // Reach final iteration step in regards to precision
-			{
-			tmp = r;			// round to final precision
-			if (tmp == c1)		// break if no improvement
-				break;
-			}
+		r = c1 - r;						// 1-VU^n
+		r *= u;							// U(1-VU^n)
+		r *= fn;						// U(1-VU^n)/n
+		u += r;							// Un=U+U(1-VU^n)/n
 		}
 
-	u = 1 / u;			// n root of u is now 1/u;
-	u.exponent(u.exponent() + expo_sq);
+	u = _float_precision_inverse(u);	// n root of u is now 1/u;
+	u.exponent(u.exponent() + expo_n);
 	// Round to same precision as argument and rounding mode
 	u.mode(x.mode());
 	u.precision(precision);
@@ -4942,6 +8773,239 @@ float_precision nroot(const float_precision& x, unsigned int n)
 	}
 
 
+//////////////////////////////////////////////////////////////////////////////////////
+///
+/// FUSED MULTIPLY ADD AND EXACT SUMS
+///   fma()
+///   sum()
+///   dot()
+///
+//////////////////////////////////////////////////////////////////////////////////////
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 		Return the number of digits in the mantissa
+///	@return		size_t	-	The number of digits in the mantissa of x
+///	@param		"x"	-	The number
+///
+///	@todo
+///
+/// Description:
+///   The mantissa is read through the const ref_mantissa() to avoid a copy from get_mantissa()
+//
+static size_t _float_precision_length( const float_precision& x )
+	{
+	return x.ref_mantissa()->length();
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 		Check for zero
+///	@return		bool	-	true if x is zero
+///	@param		"x"	-	The number
+///
+///	@todo
+///
+/// Description:
+///   A zero has the mantissa with the single digit 0
+//
+static bool _float_precision_iszero( const float_precision& x )
+	{
+	const std::string *m = x.ref_mantissa();
+
+	return m->length() == 1 && FDIGIT( (*m)[0] ) == 0;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 		Exact product
+///	@return		float_precision	-	return a*b without rounding
+///	@param		"a"	-	First operand
+///	@param		"b"	-	Second operand
+///
+///	@todo
+///
+/// Description:
+///   The product is done with a precision that hold all the digits of the product so it is exact
+//
+static float_precision _float_precision_exact_mul( const float_precision& a, const float_precision& b )
+	{
+	float_precision r( a );
+
+	r.precision( (unsigned int)( _float_precision_length( a ) + _float_precision_length( b ) ) );
+	r *= b;
+	return r;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 		Sum of terms with one rounding
+///	@return		float_precision	-	return the sum of the terms rounded to precision
+///	@param		"terms"	-	Pointers to the terms. Each term is exact. The pointers are sorted by the call
+///	@param		"precision"	-	The precision of the result
+///	@param		"mode"	-	The rounding mode of the result
+///
+///	@todo
+///
+/// Description:
+///   The terms are added from the largest exponent down in an accumulator that always get enough digits to hold the
+///   sum exact and the sum is only rounded once at the end. When the rest of the terms together is less than one unit
+///   of the digit pos that is below both the last digit of the accumulator and 2 digits below the rounding digit
+///   the rest can not change the rounding except by its sign. The rest is then replaced by a single digit at pos-1 with the
+///   sign of the sum of the rest so the accumulator never need more digits than the terms that actually overlap.
+///   The terms have different precisions and an assignment round to the precision of the left side so only the
+///   pointers are moved around and never the terms themselves
+//
+static float_precision _float_precision_exact_sum( std::vector<const float_precision *>& terms, unsigned int precision, enum round_mode mode )
+	{
+	size_t i, n, width;
+	int nd, pos, lo;
+	float_precision r( 0, precision, mode ), acc( 0, 1, mode );
+	std::vector<const float_precision *> rest;
+
+	terms.erase( std::remove_if( terms.begin(), terms.end(), []( const float_precision *t ) { return _float_precision_iszero( *t ); } ), terms.end() );
+	std::sort( terms.begin(), terms.end(), []( const float_precision *a, const float_precision *b ) { return a->exponent() > b->exponent(); } );
+	for( i = 0; i < terms.size(); ++i )
+		{
+		const float_precision& t = *terms[i];
+
+		if( !_float_precision_iszero( acc ) )
+			{
+			lo = acc.exponent() - (int)_float_precision_length( acc ) + 1;
+			pos = std::min( lo, acc.exponent() - (int)precision - 2 );
+			for( nd = 0, n = terms.size() - i; n > 0; n /= 10 )
+				++nd;
+			if( t.exponent() + nd + 1 <= pos )
+				{// The rest is less than one unit at pos. Only the sign of it matter
+				rest.assign( terms.begin() + i, terms.end() );
+				float_precision s = _float_precision_exact_sum( rest, 1, ROUND_ZERO );
+				if( !_float_precision_iszero( s ) )
+					{
+					float_precision sticky( "1", 1 );
+
+					sticky.sign( s.sign() );
+					sticky.exponent( pos - 1 );
+					acc.precision( (unsigned int)( acc.exponent() - pos + 4 ) );
+					acc += sticky;
+					}
+				break;
+				}
+			lo = std::min( lo, t.exponent() - (int)_float_precision_length( t ) + 1 );
+			width = (size_t)( std::max( acc.exponent(), t.exponent() ) - lo ) + 3;
+			}
+		else
+			width = _float_precision_length( t ) + 1;
+		if( width > acc.precision() )
+			acc.precision( (unsigned int)width );
+		acc += t;
+		}
+	r = acc;
+	return r;
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 		Fused multiply add
+///	@return		float_precision	-	return a*b+c with one rounding
+///	@param		"a"	-	First factor
+///	@param		"b"	-	Second factor
+///	@param		"c"	-	The addend
+///
+///	@todo
+///
+/// Description:
+///   a*b is done exact and added to c without rounding. Only the result is rounded to the
+///   max precision of a, b and c with the rounding mode of a
+//
+float_precision fma( const float_precision& a, const float_precision& b, const float_precision& c )
+	{
+	float_precision ab = _float_precision_exact_mul( a, b );
+	std::vector<const float_precision *> terms;
+	unsigned int precision = std::max( std::max( a.precision(), b.precision() ), c.precision() );
+
+	terms.reserve( 2 );
+	terms.push_back( &ab );
+	terms.push_back( &c );
+	return _float_precision_exact_sum( terms, precision, a.mode() );
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 		Sum with one rounding
+///	@return		float_precision	-	return x[0]+x[1]+...+x[n-1]
+///	@param		"x"	-	The numbers to add
+///	@param		"n"	-	Number of numbers
+///
+///	@todo
+///
+/// Description:
+///   The numbers are added without rounding and only the result is rounded to the max precision of the
+///   numbers with the rounding mode of x[0]. An empty sum is 0
+//
+float_precision sum( const float_precision *x, size_t n )
+	{
+	std::vector<const float_precision *> terms;
+	unsigned int precision = 0;
+	size_t i;
+
+	if( n == 0 )
+		return float_precision( 0 );
+	terms.reserve( n );
+	for( i = 0; i < n; ++i )
+		{
+		precision = std::max( precision, x[i].precision() );
+		terms.push_back( &x[i] );
+		}
+	return _float_precision_exact_sum( terms, precision, x[0].mode() );
+	}
+
+float_precision sum( const std::vector<float_precision>& x )
+	{
+	return x.empty() ? float_precision( 0 ) : sum( &x[0], x.size() );
+	}
+
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 		Dot product with one rounding
+///	@return		float_precision	-	return a[0]*b[0]+a[1]*b[1]+...+a[n-1]*b[n-1]
+///	@param		"a"	-	First vector
+///	@param		"b"	-	Second vector
+///	@param		"n"	-	Number of elements in a and b
+///
+///	@todo
+///
+/// Description:
+///   The products are exact and added without rounding so only the result is rounded to the max precision
+///   of the elements with the rounding mode of a[0]. An empty dot product is 0
+//
+float_precision dot( const float_precision *a, const float_precision *b, size_t n )
+	{
+	std::vector<float_precision> products;
+	std::vector<const float_precision *> terms;
+	unsigned int precision = 0;
+	size_t i;
+
+	if( n == 0 )
+		return float_precision( 0 );
+	products.reserve( n );
+	terms.reserve( n );
+	for( i = 0; i < n; ++i )
+		{
+		precision = std::max( precision, std::max( a[i].precision(), b[i].precision() ) );
+		products.push_back( _float_precision_exact_mul( a[i], b[i] ) );
+		terms.push_back( &products.back() );
+		}
+	return _float_precision_exact_sum( terms, precision, a[0].mode() );
+	}
+
+float_precision dot( const std::vector<float_precision>& a, const std::vector<float_precision>& b )
+	{
+	if( a.size() != b.size() )
+		throw float_precision::domain_error();
+	return a.empty() ? float_precision( 0 ) : dot( &a[0], &b[0], a.size() );
+	}
+
+
 //////////////////////////////////////////////////////////////////////////////////////
 ///
 /// TRIGONOMETRIC FUNCTIONS
@@ -4970,6 +9034,7 @@ float_precision nroot(const float_precision& x, unsigned int n)
 ///   using the identity. ArcTan(x)=2*ArcTan(x/(1+sqrt(1+x^2)))
 ///   We actually dynamically adjust the argument reduction factor by applying
 ///   more with higher precision numbers.
+///   From precision_ctrl.series_threshold() digits the series is summed with binary splitting instead
 //
 float_precision atan( const float_precision& x )
    {
@@ -4980,6 +9045,36 @@ float_precision atan( const float_precision& x )
    const float_precision c1(1), c05(0.5), c2(2);
 
    precision = x.precision()+2;
+   if( F_RADIX == BASE_10 && precision >= precision_ctrl.series_threshold() )
+      {// Reduce |x| below 0.1 with atan(x)=PI/2-atan(1/x) and three times ArcTan(x)=2*ArcTan(x/(1+sqrt(1+x^2)))
+      // and sum the series with binary splitting
+      unsigned int work = precision + 10;
+      bool inverse;
+
+      v.precision( work );
+      v = abs( x );
+      inverse = v > c1;
+      if( inverse )
+         v = _float_precision_inverse( v );
+      for( k = 0; k < 3; ++k )
+         v /= c1 + sqrt( c1 + v * v );
+      u.precision( work );
+      u = _float_precision_atan_burst( v, work );
+      u *= float_precision( 8 );
+      if( inverse )
+         {
+         r.precision( work );
+         r = _float_table( _PI, work );
+         r *= c05;
+         u = r - u;
+         }
+      if( x.sign() < 0 )
+         u.change_sign();
+      u.mode( x.mode() );
+      u.precision( x.precision() );
+      return u;
+      }
+
    v.precision( precision );
    v = x;
 
@@ -5246,6 +9341,7 @@ float_precision acos( const float_precision& x )
 ///   4) Then do the taylor.
 ///   The argument reduction is used to reduced the number of taylor iteration
 ///   and to minimize round off erros and calculation time
+///   From precision_ctrl.series_threshold() digits step 3 and 4 is replaced by binary split series
 //
 float_precision sin( const float_precision& x )
    {
@@ -5256,6 +9352,8 @@ float_precision sin( const float_precision& x )
    const float_precision c1(1), c2(2), c3(3), c4(4);
 
    precision = x.precision() + 2;
+   if( x.exponent() > 0 )  // The reduction to 0..2PI lose the integer digits of x
+      precision += x.exponent();
    // Check for augument reduction and increase precision if necessary
    zd=PLOG10( precision );
    zd *= 2.0;
@@ -5300,31 +9398,36 @@ float_precision sin( const float_precision& x )
 		  { v -= u; sign *= -1; }
       }
 
-   // Now use the trisection identity sin(3x)=3*sin(x)-4*sin(x)^3
-   // until argument is less than 0.5/3^j  Where J is the number of reduction factor based on the needed precision of the argument.
-   v2= v * float_precision( 2 * pow( 3.0, j ) );
-   for( k = 0, r = c1; v2 > r; k++ )
-      r *= c3;
-   v /= r;
-
-   v2 = v * v;
-   r = v;
-   u = v;
-
-   // Now iterate using taylor expansion
-   for( unsigned int m=3;; m+=2 )
+   if( F_RADIX == BASE_10 && precision >= precision_ctrl.series_threshold() )
+      _float_precision_sincos_burst( v, precision + 10, &u, NULL );
+   else
       {
-      de += float_precision( 4 * m - 6 ); // Avoid the multiplication in float_precision.
-      v = v2 / de;  // de is only 20 digits standard preecision but since v2 is precision it will be extended to v2 precision //( j<USHRT_MAX? float_precision( m * (m-1) ) : float_precision(m) * float_precision(m-1) );
-      r *= v;
-      r.change_sign();
-      if( u + r == u )
-         break;
-      u += r;
-      }
+      // Now use the trisection identity sin(3x)=3*sin(x)-4*sin(x)^3
+      // until argument is less than 0.5/3^j  Where J is the number of reduction factor based on the needed precision of the argument.
+      v2= v * float_precision( 2 * pow( 3.0, j ) );
+      for( k = 0, r = c1; v2 > r; k++ )
+         r *= c3;
+      v /= r;
+
+      v2 = v * v;
+      r = v;
+      u = v;
+
+      // Now iterate using taylor expansion
+      for( unsigned int m=3;; m+=2 )
+         {
+         de += float_precision( 4 * m - 6 ); // Avoid the multiplication in float_precision.
+         v = v2 / de;  // de is only 20 digits standard preecision but since v2 is precision it will be extended to v2 precision //( j<USHRT_MAX? float_precision( m * (m-1) ) : float_precision(m) * float_precision(m-1) );
+         r *= v;
+         r.change_sign();
+         if( u + r == u )
+            break;
+         u += r;
+         }
 
-   for( ; k > 0 ; k-- )
-      u *= ( c3 - c4 * u * u );
+      for( ; k > 0 ; k-- )
+         u *= ( c3 - c4 * u * u );
+      }
 
    // Round to same precision as argument and rounding mode
    u.mode( x.mode() );
@@ -5351,6 +9454,7 @@ float_precision sin( const float_precision& x )
 ///   3) Now use the trisection identity cos(3x)=-3*cos(x)+4*cos(x)^3
 ///      until argument is less than 0.5/3^argument reduction
 ///   4) Finally use Taylor
+///   From precision_ctrl.series_threshold() digits step 3 and 4 is replaced by binary split series
 //
 float_precision cos( const float_precision& x )
    {
@@ -5361,6 +9465,8 @@ float_precision cos( const float_precision& x )
    const float_precision c05(0.5), c1(1), c2(2), c3(3), c4(4);
 
    precision = x.precision() + 2;
+   if( x.exponent() > 0 )  // The reduction to 0..2PI lose the integer digits of x
+      precision += x.exponent();
    // Check for augument reduction and increase precision if necessary
    zd=PLOG10( precision );
    zd *= 2.0;
@@ -5401,30 +9507,35 @@ float_precision cos( const float_precision& x )
          v = r * c2 - v;
       }
 
-   // Now use the trisection identity cos(3x)=-3*cos(x)+4*cos(x)^3
-   // until argument is less than 0.5/3^j  Where J is the number of reduction factor based on the needed precision of the argument.
-   v2= abs( v * float_precision( 2 * pow( 3.0, j ) ) );
-   for( k = 0, r = c1; v2 > r; k++ )
-      r *= c3;
-   v /= r;
-
-   v2 = v * v;
-   r = c1;
-   u = r;
-   // Now iterate using taylor expansion
-   for( unsigned int m=2;; m+=2 )
+   if( F_RADIX == BASE_10 && precision >= precision_ctrl.series_threshold() )
+      _float_precision_sincos_burst( v, precision + 10, NULL, &u );
+   else
       {
-      de += float_precision( 4 * m - 6 ); // Avoid the multiplication in float_precision.
-      v = v2 / de;  // de is only 20 digits standard preecision but since v2 is precision is will be extended to v2 precision //( m<USHRT_MAX? float_precision( m * (m-1) ) : float_precision(m) * float_precision(m-1) );
-      r *= v;
-      r.change_sign();
-      if( u + r == u )
-         break;
-      u += r;
-      }
+      // Now use the trisection identity cos(3x)=-3*cos(x)+4*cos(x)^3
+      // until argument is less than 0.5/3^j  Where J is the number of reduction factor based on the needed precision of the argument.
+      v2= abs( v * float_precision( 2 * pow( 3.0, j ) ) );
+      for( k = 0, r = c1; v2 > r; k++ )
+         r *= c3;
+      v /= r;
+
+      v2 = v * v;
+      r = c1;
+      u = r;
+      // Now iterate using taylor expansion
+      for( unsigned int m=2;; m+=2 )
+         {
+         de += float_precision( 4 * m - 6 ); // Avoid the multiplication in float_precision.
+         v = v2 / de;  // de is only 20 digits standard preecision but since v2 is precision is will be extended to v2 precision //( m<USHRT_MAX? float_precision( m * (m-1) ) : float_precision(m) * float_precision(m-1) );
+         r *= v;
+         r.change_sign();
+         if( u + r == u )
+            break;
+         u += r;
+         }
 
-   for( ; k > 0 ; k-- )
-      u *= ( c4 * u * u - c3 );
+      for( ; k > 0 ; k-- )
+         u *= ( c4 * u * u - c3 );
+      }
 
    // Round to same precision as argument and rounding mode
    u.mode( x.mode() );
@@ -5799,6 +9910,34 @@ float_precision atanh( const float_precision& x )
 ///
 //////////////////////////////////////////////////////////////////////////////////////
 
+///	@author agent (agent@local)
+///	@date  16-Oct-2026
+///	@brief 	_int_precision_fastcorrect
+///	@return 	void	-
+///	@param   "s1"	-	The dividend
+///	@param   "s2"	-	The divisor
+///	@param   "q"	-	The estimated quotient s1/s2. Corrected on return
+///
+///	@todo
+///
+/// Description:
+///   The floating point quotient is rounded and can be one unit off when s1/s2 is very close to an integer.
+///   Correct q so the remainder s1-s2*q is less than s2 in magnitude and has the sign of s1 (truncated division)
+//
+static void _int_precision_fastcorrect( const int_precision &s1, const int_precision &s2, int_precision &q )
+	{
+	int_precision a(s1), b(s2), r;
+	const int_precision i0(0), i1(1);
+
+	a.abs(); b.abs(); q.abs();
+	for( r = a - b * q; r < i0; r += b )
+		q -= i1;
+	for( ; r >= b; r -= b )
+		q += i1;
+	if( s1.sign() * s2.sign() < 0 && q != i0 )
+		q.change_sign();
+	}
+
 int_precision _int_precision_fastdiv( const int_precision &s1, const int_precision &s2 )
 	{
 	unsigned int ss;
@@ -5815,6 +9954,7 @@ int_precision _int_precision_fastdiv( const int_precision &s1, const int_precisi
 	f2=float_precision( s2, ss+ 2);
 	rf=f1/f2;
 	r2=rf.to_int_precision();
+	_int_precision_fastcorrect( s1, s2, r2 );
 	return r2;
 	}
 
@@ -5835,6 +9975,7 @@ int_precision _int_precision_fastrem( const int_precision &s1, const int_precisi
 	f2=float_precision( s2, ss+ 2);
 	rf=f1/f2;
 	r2=rf.to_int_precision();
+	_int_precision_fastcorrect( s1, s2, r2 );
 	r2=s1-s2*r2;
 	return r2;
 	}
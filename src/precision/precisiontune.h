@@ -0,0 +1,43 @@
+#ifndef INC_PRECISIONTUNE
+#define INC_PRECISIONTUNE
+
+/*
+ *******************************************************************************
+ *
+ *
+ * Module name     :   precisiontune.h
+ * Module ID Nbr   :
+ * Description     :   Default crossover thresholds for the int_precision multiplication, division and gcd
+ *                     and for the float_precision elementary functions
+ * --------------------------------------------------------------------------
+ * Change Record   :
+ *
+ * Version	Author/Date		Description of changes
+ * -------  ---------------	----------------------
+ * 01.01	agent/16-OCT-2026	Initial release
+ * 01.02	agent/16-OCT-2026	Raised IMUL_NTT_THRESHOLD since the radix 4 FFT is now faster than the NTT up to about 250,000 digits
+ * 01.03	agent/16-OCT-2026	Added IDIV_NEWTON_THRESHOLD
+ * 01.04	agent/16-OCT-2026	Added IGCD_HGCD_THRESHOLD
+ * 01.05	agent/16-OCT-2026	Added FSERIES_THRESHOLD
+ * 01.06	agent/16-OCT-2026	Added FAGM_THRESHOLD and FEXP_NEWTON_THRESHOLD
+ * 01.07	agent/16-OCT-2026	log() no longer use FSERIES_THRESHOLD
+ *
+ * End of Change Record
+ * --------------------------------------------------------------------------
+*/
+
+// This file can be regenerated with the tune program in projects/tune which measure the crossover
+// points on the target machine. The values are only the defaults for precision_ctrl. They can be changed
+// at runtime with the coordinate functions of precision_ctrl or loaded from a file written by tune.
+
+static const size_t IKARATSUBA_THRESHOLD = 24;		// Minimum number of limbs before the limb multiplication use Karatsuba
+static const size_t ITOOM3_THRESHOLD = 160;			// Minimum number of limbs before the limb multiplication use Toom-Cook 3 way
+static const size_t IMUL_LIMB_THRESHOLD = 30000;	// Below this number of digits in the smallest operand *= use the limb multiplication instead of FFT
+static const size_t IMUL_NTT_THRESHOLD = 250000;	// From this number of digits in the smallest operand *= use the number theoretic transform instead of FFT
+static const size_t IDIV_NEWTON_THRESHOLD = 1200;	// Minimum number of limbs in the divisor and the quotient before division use Newton reciprocal and Barrett reduction
+static const size_t IGCD_HGCD_THRESHOLD = 1000;	// Minimum number of limbs before gcd() use the half gcd instead of Lehmer steps
+static const size_t FSERIES_THRESHOLD = 400;		// From this precision exp(), sin(), cos() and atan() use binary splitting series
+static const size_t FAGM_THRESHOLD = 100;			// From this precision log() use the arithmetic geometric mean instead of the Taylor series
+static const size_t FEXP_NEWTON_THRESHOLD = 1000000;	// From this precision exp() use Newton iterations on log() instead of the binary splitting series
+
+#endif
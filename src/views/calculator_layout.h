@@ -249,23 +249,19 @@ namespace gfx
 
     void renderValue(char* dest, size_t length, const calc::Calculator::value_t& value)
     {
-      float_precision i;
-      auto f = modf(value, &i);
+      static constexpr unsigned DISPLAY_DIGITS = 10;
 
-      if (value.get_mantissa().length() == value.exponent() - 1)
+      /* only the digits that fit on the display are generated so huge values cost the same as small ones */
+      int exponent;
+      std::string digits = value.leading_digits(DISPLAY_DIGITS, &exponent);
+
+      if (exponent >= 0 && exponent < (int)DISPLAY_DIGITS && digits.length() <= (size_t)exponent + 1)
       {
-        sprintf(dest, "%s", i.to_int_precision().toString().c_str());
+        digits.append(exponent + 1 - digits.length(), '0');
+        snprintf(dest, length, "%s%s", value.sign() < 0 ? "-" : "", digits.c_str());
       }
       else
-        sprintf(dest, "%s", value.toPrecision(std::min(value.get_mantissa().length() + (value.exponent() < 0 ? 1 : 0), (size_t)10)).c_str());
-
-
-
-      /*value_t truncated = trunc(value);
-      if (truncated == value)
-        sprintf(dest, "%.0f", value);
-      else
-        sprintf(dest, "%f", value);*/
+        snprintf(dest, length, "%s", value.toPrecision(std::min(digits.length() + (exponent < 0 ? 1 : 0), (size_t)DISPLAY_DIGITS)).c_str());
     }
 
   };
@@ -291,10 +287,10 @@ namespace gfx
       buttons.emplace_back(ButtonSpec("M+", 6, 0, 2, 2, gvm->font(), { 200, 200, 200 }, [](calc::Calculator& c) { c.setMemory(c.memory() + c.value()); }));
       buttons.emplace_back(ButtonSpec("MS", 0, 2, 2, 2, gvm->font(), { 200, 200, 200 }, [](calc::Calculator& c) { c.setMemory(c.value()); }));
 
-      buttons.emplace_back(ButtonSpec("÷", 9, 0, 2, 2, gvm->font(), { 200, 200, 200 }, [this](calc::Calculator& c) { c.pushOperator([](value_t v1, value_t v2) { return v1 / v2; }); digits.reset(); }));
-      buttons.emplace_back(ButtonSpec("×", 11, 0, 2, 2, gvm->font(), { 200, 200, 200 }, [this](calc::Calculator& c) { c.pushOperator([](value_t v1, value_t v2) { return v1 * v2; }); digits.reset(); }));
-      buttons.emplace_back(ButtonSpec("-", 11, 2, 2, 2, gvm->font(), { 200, 200, 200 }, [this](calc::Calculator& c) { c.pushOperator([](value_t v1, value_t v2) { return v1 - v2; }); digits.reset(); }));
-      buttons.emplace_back(ButtonSpec("+", 11, 4, 2, 4, gvm->font(), { 200, 200, 200 }, [this](calc::Calculator& c) { c.pushOperator([](value_t v1, value_t v2) { return v1 + v2; }); digits.reset(); }));
+      buttons.emplace_back(ButtonSpec("÷", 9, 0, 2, 2, gvm->font(), { 200, 200, 200 }, [this](calc::Calculator& c) { c.pushOperator([](value_t v1, value_t v2) { return std::move(v1) / v2; }); digits.reset(); }));
+      buttons.emplace_back(ButtonSpec("×", 11, 0, 2, 2, gvm->font(), { 200, 200, 200 }, [this](calc::Calculator& c) { c.pushOperator([](value_t v1, value_t v2) { return std::move(v1) * v2; }); digits.reset(); }));
+      buttons.emplace_back(ButtonSpec("-", 11, 2, 2, 2, gvm->font(), { 200, 200, 200 }, [this](calc::Calculator& c) { c.pushOperator([](value_t v1, value_t v2) { return std::move(v1) - v2; }); digits.reset(); }));
+      buttons.emplace_back(ButtonSpec("+", 11, 4, 2, 4, gvm->font(), { 200, 200, 200 }, [this](calc::Calculator& c) { c.pushOperator([](value_t v1, value_t v2) { return std::move(v1) + v2; }); digits.reset(); }));
       buttons.emplace_back(ButtonSpec("=", 11, 8, 2, 2, gvm->font(), { 200, 200, 200 }, [this](calc::Calculator& c) { c.applyFromStack(); digits.reset(); }));
 
 
@@ -324,10 +320,10 @@ namespace gfx
       buttons.emplace_back(ButtonSpec("ln", 6, 1, 2, 1, gvm->tinyFont(), { 255, 255, 255 }, [](calc::Calculator& c) {}));
       buttons.emplace_back(ButtonSpec("e", 6, 2, 2, 1, gvm->tinyFont(), { 255, 255, 255 }, [](calc::Calculator& c) {}));
 
-      buttons.emplace_back(ButtonSpec("÷", 12, 4, 2, 1, gvm->tinyFont(), { 200, 200, 200 }, [this](calc::Calculator& c) { c.pushOperator([](value_t v1, value_t v2) { return v1 / v2; }); digits.reset(); }));
-      buttons.emplace_back(ButtonSpec("×", 12, 5, 2, 1, gvm->tinyFont(), { 200, 200, 200 }, [this](calc::Calculator& c) { c.pushOperator([](value_t v1, value_t v2) { return v1 * v2; }); digits.reset(); }));
-      buttons.emplace_back(ButtonSpec("-", 14, 4, 2, 1, gvm->tinyFont(), { 200, 200, 200 }, [this](calc::Calculator& c) { c.pushOperator([](value_t v1, value_t v2) { return v1 - v2; }); digits.reset(); }));
-      buttons.emplace_back(ButtonSpec("+", 14, 5, 2, 1, gvm->tinyFont(), { 200, 200, 200 }, [this](calc::Calculator& c) { c.pushOperator([](value_t v1, value_t v2) { return v1 + v2; }); digits.reset(); }));
+      buttons.emplace_back(ButtonSpec("÷", 12, 4, 2, 1, gvm->tinyFont(), { 200, 200, 200 }, [this](calc::Calculator& c) { c.pushOperator([](value_t v1, value_t v2) { return std::move(v1) / v2; }); digits.reset(); }));
+      buttons.emplace_back(ButtonSpec("×", 12, 5, 2, 1, gvm->tinyFont(), { 200, 200, 200 }, [this](calc::Calculator& c) { c.pushOperator([](value_t v1, value_t v2) { return std::move(v1) * v2; }); digits.reset(); }));
+      buttons.emplace_back(ButtonSpec("-", 14, 4, 2, 1, gvm->tinyFont(), { 200, 200, 200 }, [this](calc::Calculator& c) { c.pushOperator([](value_t v1, value_t v2) { return std::move(v1) - v2; }); digits.reset(); }));
+      buttons.emplace_back(ButtonSpec("+", 14, 5, 2, 1, gvm->tinyFont(), { 200, 200, 200 }, [this](calc::Calculator& c) { c.pushOperator([](value_t v1, value_t v2) { return std::move(v1) + v2; }); digits.reset(); }));
       buttons.emplace_back(ButtonSpec("=", 14, 6, 2, 2, gvm->tinyFont(), { 200, 200, 200 }, [this](calc::Calculator& c) { c.applyFromStack(); digits.reset(); }));
 
       LayoutHelper::addNumberGrid(buttons, 6, 4, 2, 1, gvm->tinyFont());
@@ -3,6 +3,12 @@
 #include "calculator_view.h"
 #include "graph_view.h"
 
+#ifdef _WIN32
+static const std::string dataPrefix = "../../../";
+#else
+static const std::string dataPrefix = "";
+#endif
+
 ui::ViewManager::ViewManager() : SDL<ui::ViewManager, ui::ViewManager>(*this, *this), textureUI(nullptr), _font(nullptr), _tinyFont(nullptr)
 {
 
@@ -12,17 +18,17 @@ void ui::ViewManager::deinit()
 {
   TTF_CloseFont(_font);
   TTF_CloseFont(_tinyFont);
+
+  /* keep the digits of pi, e, ln2 and ln10 computed this run for the next one */
+  _float_table_save((dataPrefix + "data/precision.constants").c_str());
+
   SDL_DestroyTexture(textureUI);
   SDL::deinit();
 }
 
 bool ui::ViewManager::loadData()
 {
-#ifdef _WIN32
-  const std::string prefix = "../../../";
-#else
-  const std::string prefix = "";
-#endif
+  const std::string& prefix = dataPrefix;
 
   SDL_Surface* surfaceUI = IMG_Load((prefix + "data/ui.png").c_str());
 
@@ -49,6 +55,11 @@ bool ui::ViewManager::loadData()
 
   _cache.init(getRenderer(), 128, 128);
 
+  /* optional multiplication thresholds measured on this machine by projects/tune */
+  precision_ctrl.load_thresholds((prefix + "data/precision.tune").c_str());
+  /* constants saved by a previous run so a high precision does not have to compute them again. A corrupt file is ignored */
+  _float_table_load((prefix + "data/precision.constants").c_str());
+
   views[0] = new CalculatorView<gfx::EasyLayout>(this);
   views[1] = new CalculatorView<gfx::ScientificLayout>(this);
   views[2] = new GraphView(this);